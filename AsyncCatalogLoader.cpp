@@ -0,0 +1,268 @@
+#include <algorithm>                                                        // max()
+#include <condition_variable>                                               // condition_variable_any
+#include <coroutine>                                                        // coroutine_handle, suspend_never
+#include <cstddef>                                                          // size_t
+#include <deque>                                                            // deque
+#include <exception>                                                        // current_exception(), terminate()
+#include <filesystem>                                                       // path
+#include <format>                                                           // format()
+#include <fstream>                                                          // ifstream
+#include <functional>                                                       // function
+#include <iostream>                                                         // istream, streambuf, ws()
+#include <memory>                                                           // make_unique()
+#include <mutex>                                                            // mutex, scoped_lock, unique_lock
+#include <stop_token>                                                       // stop_token
+#include <string>                                                           // string
+#include <string_view>                                                      // string_view
+#include <system_error>                                                     // system_error, make_error_code(), errc
+#include <thread>                                                           // jthread
+#include <utility>                                                          // move()
+#include <vector>                                                           // vector
+
+#include "AsyncCatalogLoader.hpp"
+#include "GroceryItem.hpp"
+#include "GroceryList.hpp"
+
+
+
+
+/*******************************************************************************
+**  Work queue
+*******************************************************************************/
+class AsyncCatalogLoader::WorkQueue
+{
+  public:
+    explicit WorkQueue( unsigned threadCount )
+    {
+      for( unsigned i = 0; i < threadCount; ++i )   _threads.emplace_back( [this]( std::stop_token stop ) { run( stop ); } );
+    }
+
+    void post( std::coroutine_handle<> coroutine )
+    {
+      {
+        std::scoped_lock lock( _mutex );
+        _ready.push_back( coroutine );
+      }
+      _available.notify_one();
+    }
+
+  private:
+    void run( std::stop_token stop )
+    {
+      while( true )
+      {
+        std::unique_lock lock( _mutex );
+        if( !_available.wait( lock, stop, [&] { return !_ready.empty(); } ) )   return;   // stop requested
+
+        auto coroutine = _ready.front();
+        _ready.pop_front();
+        lock.unlock();
+
+        coroutine.resume();                                                 // runs until the coroutine next yields or finishes
+      }
+    }
+
+    std::mutex                          _mutex;
+    std::condition_variable_any         _available;
+    std::deque<std::coroutine_handle<>> _ready;
+    std::vector<std::jthread>           _threads;                           // last, so they are stopped and joined before the queue goes away
+};
+
+
+
+
+/*******************************************************************************
+**  Implementation of non-member private types, objects, and functions
+*******************************************************************************/
+namespace    // unnamed, anonymous namespace
+{
+  // The coroutine type of a load.  Nothing waits on a load's coroutine directly, it reports its own completion, so its frame is
+  // destroyed as soon as it finishes.
+  struct LoadTask
+  {
+    struct promise_type
+    {
+      LoadTask           get_return_object  () noexcept { return {}; }
+      std::suspend_never initial_suspend    () noexcept { return {}; }
+      std::suspend_never final_suspend      () noexcept { return {}; }
+      void               return_void        () noexcept {}
+      void               unhandled_exception() noexcept { std::terminate(); }   // the coroutine body catches everything
+    };
+  };
+
+
+
+  // co_await'ing this suspends the coroutine and queues it to be resumed by one of the work queue's threads
+  template<typename Queue>
+  struct ResumeOn
+  {
+    Queue & queue;
+
+    bool await_ready  (                                   ) const noexcept { return false; }
+    void await_suspend( std::coroutine_handle<> coroutine ) const          { queue.post( coroutine ); }
+    void await_resume (                                   ) const noexcept {}
+  };
+
+
+
+  // A read-only stream buffer over characters owned elsewhere, so records are parsed in place and the parse position can be read
+  struct ViewBuffer : std::streambuf
+  {
+    explicit ViewBuffer( std::string_view text )
+    {
+      auto first = const_cast<char *>( text.data() );                      // get area only, never written through
+      setg( first, first, first + text.size() );
+    }
+
+    std::size_t position() const noexcept { return static_cast<std::size_t>( gptr() - eback() ); }
+  };
+
+
+
+  // Parses every complete record at the front of text into the grocery list, and returns how many characters were consumed.  A
+  // record is complete once something follows its price, because the price is the one field that could still be growing.  At the
+  // end of the file everything must parse.  The first malformed record ends the load, as it would end the extraction operator's
+  // loop, but is reported rather than silently ignored.
+  std::size_t parseRecords( std::string_view text, bool endOfFile, AsyncCatalogLoader::Result & result, std::size_t offset )
+  {
+    ViewBuffer   buffer( text );
+    std::istream stream( &buffer );
+
+    std::size_t consumed = 0;
+    GroceryItem groceryItem;
+    while( ( stream >> std::ws ).peek() != std::istream::traits_type::eof() )
+    {
+      auto start = buffer.position();
+      if( !( stream >> groceryItem ) || ( !endOfFile && stream.peek() == std::istream::traits_type::eof() ) )
+      {
+        if( !endOfFile )   break;                                          // probably cut off by the end of the chunk, wait for more
+        throw std::system_error( std::make_error_code( std::errc::bad_message ),
+                                 std::format( "malformed grocery item at byte {} of \"{}\"", offset + start, result.path.string() ) );
+      }
+
+      ++result.records;
+      result.groceryList.insert( std::move( groceryItem ), GroceryList::Position::BOTTOM );
+      consumed = buffer.position();
+    }
+
+    return endOfFile ? text.size() : consumed;
+  }
+
+
+
+  // Loads one file a chunk at a time, yielding to other loads between chunks, then reports completion
+  template<typename Queue>
+  LoadTask loadFile( Queue & queue, AsyncCatalogLoader::Result & result, std::function<void()> finished )
+  {
+    try
+    {
+      co_await ResumeOn<Queue>{ queue };                                    // never block the thread that started the load
+
+      std::ifstream file( result.path, std::ios::binary );
+      if( !file )   throw std::system_error( std::make_error_code( std::errc::io_error ), std::format( "unable to open \"{}\"", result.path.string() ) );
+
+      std::vector<char> chunk( AsyncCatalogLoader::READ_SIZE );
+      std::string       pending;                                            // the unparsed tail of what has been read
+      std::size_t       pendingOffset = 0;                                  // where pending starts in the file
+      bool              endOfFile     = false;
+
+      while( !endOfFile )
+      {
+        file.read( chunk.data(), static_cast<std::streamsize>( chunk.size() ) );
+        if( file.bad() )   throw std::system_error( std::make_error_code( std::errc::io_error ), std::format( "unable to read \"{}\"", result.path.string() ) );
+
+        auto count    = static_cast<std::size_t>( file.gcount() );
+        endOfFile     = file.eof();
+        result.bytes += count;
+        pending.append( chunk.data(), count );
+
+        auto consumed  = parseRecords( pending, endOfFile, result, pendingOffset );
+        pending.erase( 0, consumed );
+        pendingOffset += consumed;
+
+        if( !endOfFile )   co_await ResumeOn<Queue>{ queue };               // let other files' chunks run before reading the next
+      }
+    }
+    catch( ... )
+    {
+      result.error = std::current_exception();
+    }
+
+    finished();
+  }
+}    // unnamed, anonymous namespace
+
+
+
+
+/*******************************************************************************
+**  Constructors, destructor, and assignments
+*******************************************************************************/
+
+// Thread Count Constructor
+AsyncCatalogLoader::AsyncCatalogLoader( unsigned threadCount )
+  : _workQueue( std::make_unique<WorkQueue>( std::max( threadCount, 1u ) ) )   // hardware_concurrency() may report 0 when unknown
+{}
+
+
+
+// Destructor
+AsyncCatalogLoader::~AsyncCatalogLoader() noexcept
+{
+  // Loads in flight write to this loader's results, so let them finish.  Only then may the work queue's threads be stopped.
+  std::unique_lock lock( _mutex );
+  _finished.wait( lock, [&] { return _inFlight == 0; } );
+}
+
+
+
+
+/*******************************************************************************
+**  Modifiers
+*******************************************************************************/
+
+// load()
+void AsyncCatalogLoader::load( std::filesystem::path path )
+{
+  Result * result = nullptr;
+  {
+    std::scoped_lock lock( _mutex );
+    _results.push_back( std::make_unique<Result>() );
+    result       = _results.back().get();
+    result->path = std::move( path );
+    ++_inFlight;
+  }
+
+  // Completion is signaled while holding the lock, so a waiter can't see _inFlight reach zero, return, and destroy this loader
+  // before the signal is sent
+  auto finished = [this]
+  {
+    std::scoped_lock lock( _mutex );
+    if( --_inFlight == 0 )   _finished.notify_all();
+  };
+
+  try
+  {
+    loadFile( *_workQueue, *result, finished );
+  }
+  catch( ... )                                                              // the coroutine frame couldn't be allocated, so the load never started
+  {
+    result->error = std::current_exception();
+    finished();
+  }
+}
+
+
+
+// wait()
+std::vector<AsyncCatalogLoader::Result> AsyncCatalogLoader::wait()
+{
+  std::unique_lock lock( _mutex );
+  _finished.wait( lock, [&] { return _inFlight == 0; } );
+
+  std::vector<Result> results;
+  results.reserve( _results.size() );
+  for( auto & result : _results )   results.push_back( std::move( *result ) );
+  _results.clear();
+  return results;
+}
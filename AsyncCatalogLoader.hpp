@@ -0,0 +1,71 @@
+#pragma once                                                                                      // include guard
+
+#include <condition_variable>                                                                     // condition_variable
+#include <cstddef>                                                                                // size_t
+#include <exception>                                                                              // exception_ptr
+#include <filesystem>                                                                             // path
+#include <memory>                                                                                 // unique_ptr
+#include <mutex>                                                                                  // mutex
+#include <thread>                                                                                 // hardware_concurrency()
+#include <vector>
+
+#include "GroceryList.hpp"
+
+
+// An AsyncCatalogLoader reads many catalog files (grocery item text, the format GroceryList's extraction operator reads) at once, so
+// startup costs about as long as the slowest file rather than the sum of them all.  Each file is loaded by a coroutine that reads a
+// chunk, parses every complete record in it, then yields so other files' chunks can run before reading its next.  The coroutines
+// are resumed by a small pool of worker threads, so the number of files in flight isn't limited by the number of threads.
+//
+// Each file becomes its own GroceryList, read exactly as the extraction operator would read it:  grocery items in file order,
+// duplicates dropped.  Where the extraction operator would silently stop, the loader also stops but reports why.  Errors are kept
+// per file and never stop other files loading.
+//
+//    AsyncCatalogLoader loader;
+//    for( auto const & path : catalogPaths )   loader.load( path );
+//    for( auto & result : loader.wait() )      if( result.error )  ...  else  use( result.groceryList );
+//
+// load() and wait() are meant to be called from one thread.
+class AsyncCatalogLoader
+{
+  public:
+    // Types
+    struct Result
+    {
+      std::filesystem::path path;
+      GroceryList           groceryList;                                                          // grocery items read before any error
+      std::size_t           bytes   = 0;                                                          // input consumed
+      std::size_t           records = 0;                                                          // grocery items parsed, including dropped duplicates
+      std::exception_ptr    error;                                                                // std::system_error for unreadable or malformed files, GroceryList_Ex from the list
+    };
+
+    static constexpr std::size_t READ_SIZE = 64 * 1024;                                           // bytes read per chunk before yielding to other files
+
+
+    // Constructors, destructor, and assignments
+    //
+    // Loads in flight refer back to their loader, so loaders can be neither copied nor moved.
+    explicit AsyncCatalogLoader( unsigned threadCount = std::thread::hardware_concurrency() );
+
+    AsyncCatalogLoader            ( AsyncCatalogLoader const & ) = delete;
+    AsyncCatalogLoader & operator=( AsyncCatalogLoader const & ) = delete;
+   ~AsyncCatalogLoader() noexcept;                                                                // waits for loads in flight, discarding their results
+
+
+    // Modifiers
+    void                load( std::filesystem::path path );                                       // starts loading the file and returns at once
+    std::vector<Result> wait();                                                                   // blocks until every started load finishes, returns their results in the order started
+
+
+  private:
+    // Types
+    class WorkQueue;                                                                              // coroutines ready to resume, and the threads resuming them
+
+    // Instance Attributes
+    std::mutex                           _mutex;                                                  // guards _results and _inFlight
+    std::condition_variable              _finished;                                               // signaled when _inFlight drops to zero
+    std::vector<std::unique_ptr<Result>> _results;                                                // stable addresses, each load writes only to its own
+    std::size_t                          _inFlight = 0;
+
+    std::unique_ptr<WorkQueue>           _workQueue;                                              // last, so its threads stop before anything they use goes away
+};
@@ -0,0 +1,160 @@
+#include <algorithm>                                                        // clamp(), max(), fill()
+#include <cmath>                                                            // ceil(), log(), round()
+#include <cstddef>                                                          // size_t
+#include <cstdint>                                                          // uint64_t
+
+#include "BloomFilter.hpp"
+
+
+
+
+
+
+
+
+
+
+
+/*******************************************************************************
+**  Implementation of non-member private types, objects, and functions
+*******************************************************************************/
+namespace    // unnamed, anonymous namespace
+{
+  // Derives a second, independent looking hash from the first (splitmix64 finalizer).  Probe i then tests bit (h1 + i*h2) mod m,
+  // the Kirsch-Mitzenmacher double hashing scheme, which performs as well as k truly independent hash functions.
+  constexpr std::uint64_t remix( std::uint64_t x ) noexcept
+  {
+    x ^= x >> 30;   x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27;   x *= 0x94d049bb133111ebULL;
+    x ^= x >> 31;
+    return x;
+  }
+}    // unnamed, anonymous namespace
+
+
+
+
+
+
+
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Constructors and Destructors
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Sizing Constructor
+BloomFilter::BloomFilter( std::size_t expectedElements, double falsePositiveRate )
+  : _capacity         ( std::max<std::size_t>( expectedElements, 1 ) ),
+    _falsePositiveRate( std::clamp( falsePositiveRate, 1e-9, 0.5 ) )
+{
+  // Optimal sizing:  m = -n ln(p) / (ln 2)^2 bits and k = (m/n) ln 2 probes
+  constexpr double LN2 = 0.693147180559945309417;
+
+  auto bits   = std::ceil( -static_cast<double>( _capacity ) * std::log( _falsePositiveRate ) / ( LN2 * LN2 ) );
+  _bitCount   = std::max<std::size_t>( static_cast<std::size_t>( bits ), 64 );
+  _probeCount = std::max( 1u, static_cast<unsigned>( std::round( static_cast<double>( _bitCount ) / static_cast<double>( _capacity ) * LN2 ) ) );
+  _bits.assign( ( _bitCount + 63 ) / 64, 0 );
+}
+
+
+
+
+
+
+
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Queries
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// mayContain() const
+bool BloomFilter::mayContain( std::size_t hash ) const noexcept
+{
+  std::uint64_t h1 = hash;
+  std::uint64_t h2 = remix( h1 ) | 1;                                       // odd, so successive probes never collapse onto one bit
+
+  for( unsigned i = 0; i < _probeCount; ++i )
+  {
+    auto bit = ( h1 + i * h2 ) % _bitCount;
+    if( ( _bits[bit / 64] & ( std::uint64_t{ 1 } << ( bit % 64 ) ) ) == 0 )   return false;
+  }
+  return true;
+}
+
+
+
+// size() const
+std::size_t BloomFilter::size() const noexcept
+{
+  return _size;
+}
+
+
+
+// capacity() const
+std::size_t BloomFilter::capacity() const noexcept
+{
+  return _capacity;
+}
+
+
+
+// falsePositiveRate() const
+double BloomFilter::falsePositiveRate() const noexcept
+{
+  return _falsePositiveRate;
+}
+
+
+
+// heapBytes() const
+std::size_t BloomFilter::heapBytes() const noexcept
+{
+  return _bits.capacity() * sizeof( std::uint64_t );
+}
+
+
+
+
+
+
+
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Modifiers
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// insert()
+void BloomFilter::insert( std::size_t hash ) noexcept
+{
+  std::uint64_t h1 = hash;
+  std::uint64_t h2 = remix( h1 ) | 1;
+
+  for( unsigned i = 0; i < _probeCount; ++i )
+  {
+    auto bit = ( h1 + i * h2 ) % _bitCount;
+    _bits[bit / 64] |= std::uint64_t{ 1 } << ( bit % 64 );
+  }
+  ++_size;
+}
+
+
+
+// clear()
+void BloomFilter::clear() noexcept
+{
+  std::fill( _bits.begin(), _bits.end(), 0 );
+  _size = 0;
+}
@@ -0,0 +1,39 @@
+#pragma once                                                                                      // include guard
+
+#include <cstddef>                                                                                // size_t
+#include <cstdint>                                                                                // uint64_t
+#include <vector>
+
+
+// A BloomFilter is a compact, probabilistic set of hash values.  mayContain() never reports false for a hash value that has been
+// inserted (no false negatives), but may report true for one that hasn't (a false positive) at roughly the configured rate once
+// the expected number of elements has been inserted.  Elements cannot be removed; clear and re-insert instead.
+class BloomFilter
+{
+  public:
+    // Constructors, destructor, and assignments
+    explicit BloomFilter( std::size_t expectedElements = 64, double falsePositiveRate = 0.01 );   // sizes the bit array and number of probes accordingly
+
+
+    // Queries
+    bool        mayContain       ( std::size_t hash ) const noexcept;                             // false means definitely not inserted
+    std::size_t size             (                  ) const noexcept;                             // number of insertions since construction or clear()
+    std::size_t capacity         (                  ) const noexcept;                             // number of elements the filter was sized for
+    double      falsePositiveRate(                  ) const noexcept;                             // target rate at capacity
+    std::size_t heapBytes        (                  ) const noexcept;                             // memory held by the bit array
+
+
+    // Modifiers
+    void insert( std::size_t hash ) noexcept;
+    void clear (                  ) noexcept;
+
+
+  private:
+    // Instance Attributes
+    std::vector<std::uint64_t> _bits;                                                             // bit array, 64 bits per word
+    std::size_t                _bitCount          = 0;
+    unsigned                   _probeCount        = 0;                                            // number of bits set (and tested) per element
+    std::size_t                _capacity          = 0;
+    double                     _falsePositiveRate = 0.0;
+    std::size_t                _size              = 0;
+};
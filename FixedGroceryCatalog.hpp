@@ -0,0 +1,232 @@
+#pragma once                                                                                      // include guard
+
+#include <concepts>                                                                               // same_as
+#include <cstddef>                                                                                // size_t
+#include <format>                                                                                 // format()
+#include <string>                                                                                 // string
+#include <string_view>                                                                            // string_view
+#include <utility>                                                                                // move()
+#include <vector>
+
+#include "GroceryItem.hpp"
+#include "GroceryList.hpp"
+
+
+// A FixedGroceryItem is a grocery item whose text lives elsewhere, typically in string literals, so it can be a compile time
+// constant.  Attributes are in GroceryItem's constructor order.
+struct FixedGroceryItem
+{
+  std::string_view productName;
+  std::string_view brandName   = {};
+  std::string_view upcCode     = {};
+  double           price       = 0.0;
+
+  constexpr bool operator==( FixedGroceryItem const & rhs ) const noexcept;                      // same meaning as GroceryItem's, prices equal within Epsilon
+            bool operator==( GroceryItem      const & rhs ) const noexcept;
+
+  GroceryItem toGroceryItem() const;
+};
+
+
+
+// A FixedGroceryCatalog is a read-only grocery list built entirely at compile time, for lists known when the program is written
+// (default staples, say).  It lives in the program image, so it costs nothing at startup:  no heap allocation, no duplicate scans,
+// no container consistency checks.  Duplicates are rejected at compile time.  It offers GroceryList's read-only interface and
+// converts to a GroceryList where one is needed.
+//
+//    static constexpr FixedGroceryCatalog staples{ { {"milk", "Horizon", "742365005166", 4.99}, {"eggs", "Vital Farms"} } };
+template<std::size_t N>
+class FixedGroceryCatalog
+{
+  public:
+    // Types
+    using value_type     = FixedGroceryItem;
+    using size_type      = std::size_t;
+    using const_iterator = FixedGroceryItem const *;
+    using iterator       = const_iterator;
+
+
+    // Constructors, destructor, and assignments
+    consteval FixedGroceryCatalog( FixedGroceryItem const ( & groceryItems )[N] );                // fails to compile if any two grocery items are equal
+
+
+    // Queries
+    constexpr std::size_t size() const noexcept;
+
+
+    // Accessors
+    constexpr std::size_t find( FixedGroceryItem const & groceryItem ) const noexcept;            // returns the grocery item's (zero-based) offset from top, size() if grocery item not found
+    template<std::same_as<GroceryItem> Item>                                                      // a template, so a braced list always means a FixedGroceryItem
+              std::size_t find( Item             const & groceryItem ) const noexcept;
+
+    constexpr FixedGroceryItem const & operator[]( std::size_t offsetFromTop ) const;             // unchecked, like std::array
+    constexpr FixedGroceryItem const & at        ( std::size_t offsetFromTop ) const;             // throws GroceryList::InvalidOffset_Ex if offsetFromTop >= size()
+
+    constexpr const_iterator begin() const noexcept;
+    constexpr const_iterator end  () const noexcept;
+
+
+    // Conversions
+    GroceryList toGroceryList() const;                                                            // fails to compile if N exceeds GroceryList::CAPACITY
+    operator    GroceryList  () const;                                                            // so a catalog can be passed wherever a GroceryList is expected
+
+
+  private:
+    // Instance Attributes
+    FixedGroceryItem _groceryItems[N];
+};
+
+
+// Deduce the capacity from the braced list
+template<std::size_t N>
+FixedGroceryCatalog( FixedGroceryItem const ( & )[N] ) -> FixedGroceryCatalog<N>;
+
+
+
+
+
+
+
+
+/*******************************************************************************
+**  Inline and template definitions
+*******************************************************************************/
+
+// FixedGroceryItem::operator==( FixedGroceryItem ) const
+constexpr bool FixedGroceryItem::operator==( FixedGroceryItem const & rhs ) const noexcept
+{
+  return floating_point_is_equal( price, rhs.price )
+      && upcCode     == rhs.upcCode
+      && brandName   == rhs.brandName
+      && productName == rhs.productName;
+}
+
+
+
+// FixedGroceryItem::operator==( GroceryItem ) const
+inline bool FixedGroceryItem::operator==( GroceryItem const & rhs ) const noexcept
+{
+  return floating_point_is_equal( price, rhs.price() )
+      && upcCode     == rhs.upcCode()
+      && brandName   == rhs.brandName()
+      && productName == rhs.productName();
+}
+
+
+
+// FixedGroceryItem::toGroceryItem() const
+inline GroceryItem FixedGroceryItem::toGroceryItem() const
+{
+  return GroceryItem( std::string( productName ), std::string( brandName ), std::string( upcCode ), price );
+}
+
+
+
+// Array Constructor
+template<std::size_t N>
+consteval FixedGroceryCatalog<N>::FixedGroceryCatalog( FixedGroceryItem const ( & groceryItems )[N] )
+{
+  for( std::size_t i = 0; i < N; ++i )
+  {
+    for( std::size_t j = 0; j < i; ++j )
+    {
+      // Throwing during constant evaluation is a compile time error, and the compiler points here
+      if( groceryItems[i] == groceryItems[j] )   throw "FixedGroceryCatalog: duplicate grocery item";
+    }
+    _groceryItems[i] = groceryItems[i];
+  }
+}
+
+
+
+// size() const
+template<std::size_t N>
+constexpr std::size_t FixedGroceryCatalog<N>::size() const noexcept
+{
+  return N;
+}
+
+
+
+// find( FixedGroceryItem ) const
+template<std::size_t N>
+constexpr std::size_t FixedGroceryCatalog<N>::find( FixedGroceryItem const & groceryItem ) const noexcept
+{
+  for( std::size_t i = 0; i < N; ++i )   if( _groceryItems[i] == groceryItem )   return i;
+  return N;
+}
+
+
+
+// find( GroceryItem ) const
+template<std::size_t N>
+template<std::same_as<GroceryItem> Item>
+std::size_t FixedGroceryCatalog<N>::find( Item const & groceryItem ) const noexcept
+{
+  for( std::size_t i = 0; i < N; ++i )   if( _groceryItems[i] == groceryItem )   return i;
+  return N;
+}
+
+
+
+// operator[]() const
+template<std::size_t N>
+constexpr FixedGroceryItem const & FixedGroceryCatalog<N>::operator[]( std::size_t offsetFromTop ) const
+{
+  return _groceryItems[offsetFromTop];
+}
+
+
+
+// at() const
+template<std::size_t N>
+constexpr FixedGroceryItem const & FixedGroceryCatalog<N>::at( std::size_t offsetFromTop ) const
+{
+  if( offsetFromTop >= N )   throw GroceryList::InvalidOffset_Ex( std::format( "Access position beyond end of current list size\n  position:     {:>2}\n  current size: {:>2}", offsetFromTop, N ) );
+  return _groceryItems[offsetFromTop];
+}
+
+
+
+// begin() const
+template<std::size_t N>
+constexpr typename FixedGroceryCatalog<N>::const_iterator FixedGroceryCatalog<N>::begin() const noexcept
+{
+  return _groceryItems;
+}
+
+
+
+// end() const
+template<std::size_t N>
+constexpr typename FixedGroceryCatalog<N>::const_iterator FixedGroceryCatalog<N>::end() const noexcept
+{
+  return _groceryItems + N;
+}
+
+
+
+// toGroceryList() const
+template<std::size_t N>
+GroceryList FixedGroceryCatalog<N>::toGroceryList() const
+{
+  static_assert( N <= GroceryList::CAPACITY, "FixedGroceryCatalog: too many grocery items to convert to a GroceryList" );
+
+  // Duplicates were ruled out at compile time, so the grocery items go straight in without GroceryList's per-item duplicate checks
+  std::vector<GroceryItem> groceryItems;
+  groceryItems.reserve( N );
+  for( auto && groceryItem : _groceryItems )   groceryItems.push_back( groceryItem.toGroceryItem() );
+
+  GroceryList groceryList;
+  groceryList.replaceContents( std::move( groceryItems ) );
+  return groceryList;
+}
+
+
+
+// operator GroceryList() const
+template<std::size_t N>
+FixedGroceryCatalog<N>::operator GroceryList() const
+{
+  return toGroceryList();
+}
@@ -0,0 +1,162 @@
+#pragma once                                                                                      // include guard
+
+#include <algorithm>                                                                              // move(), move_backward(), max()
+#include <cstddef>                                                                                // size_t, ptrdiff_t
+#include <iterator>                                                                               // random_access_iterator_tag
+#include <span>                                                                                   // span
+#include <type_traits>                                                                            // conditional_t
+#include <utility>                                                                                // move(), pair
+#include <vector>
+
+
+// A GapBuffer is a contiguous sequence with a movable hole (the gap) of spare capacity.  Inserting or erasing at the gap is O(1);
+// elsewhere the gap is first moved there, shifting only the elements between the old and new gap positions.  Edits that cluster
+// around one position, in particular repeated insertions at the front, are therefore amortized O(1) instead of shifting every
+// element the way std::vector::insert( begin(), ... ) does.
+//
+// Storage is contiguous except for the gap, so scans walk at most two contiguous segments (see segments()).
+//
+// Slots in the gap hold default constructed (or moved-from) elements, so T must be default constructible and move assignable.
+template<typename T>
+class GapBuffer
+{
+  public:
+    // Types
+    template<bool IsConst>
+    class basic_iterator                                                                          // random access by logical position, skipping the gap
+    {
+      public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type        = T;
+        using difference_type   = std::ptrdiff_t;
+        using owner_type        = std::conditional_t<IsConst, GapBuffer const, GapBuffer>;
+        using reference         = std::conditional_t<IsConst, T const &, T &>;
+        using pointer           = std::conditional_t<IsConst, T const *, T *>;
+
+        basic_iterator() = default;
+        basic_iterator( owner_type * owner, std::size_t position ) noexcept : _owner( owner ), _position( position ) {}
+        operator basic_iterator<true>() const noexcept requires( !IsConst ) { return { _owner, _position }; }
+
+        reference        operator* (                     ) const noexcept { return ( *_owner )[_position];                          }
+        pointer          operator->(                     ) const noexcept { return &( *_owner )[_position];                         }
+        reference        operator[]( difference_type n   ) const noexcept { return ( *_owner )[_position + n];                      }
+        basic_iterator & operator++(                     )       noexcept { ++_position;  return *this;                             }
+        basic_iterator & operator--(                     )       noexcept { --_position;  return *this;                             }
+        basic_iterator   operator++( int                 )       noexcept { auto previous = *this;  ++_position;  return previous;  }
+        basic_iterator   operator--( int                 )       noexcept { auto previous = *this;  --_position;  return previous;  }
+        basic_iterator & operator+=( difference_type n   )       noexcept { _position += n;  return *this;                          }
+        basic_iterator & operator-=( difference_type n   )       noexcept { _position -= n;  return *this;                          }
+
+        friend basic_iterator  operator+ ( basic_iterator it, difference_type n ) noexcept { return it += n; }
+        friend basic_iterator  operator+ ( difference_type n, basic_iterator it ) noexcept { return it += n; }
+        friend basic_iterator  operator- ( basic_iterator it, difference_type n ) noexcept { return it -= n; }
+        friend difference_type operator- ( basic_iterator const & lhs, basic_iterator const & rhs ) noexcept { return static_cast<difference_type>( lhs._position ) - static_cast<difference_type>( rhs._position ); }
+        friend bool            operator==( basic_iterator const & lhs, basic_iterator const & rhs ) noexcept { return lhs._position ==  rhs._position; }
+        friend auto            operator<=>( basic_iterator const & lhs, basic_iterator const & rhs ) noexcept { return lhs._position <=> rhs._position; }
+
+        std::size_t position() const noexcept { return _position; }
+
+      private:
+        owner_type * _owner    = nullptr;
+        std::size_t  _position = 0;
+    };
+
+    using value_type     = T;
+    using size_type      = std::size_t;
+    using iterator       = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+
+    // Constructors, destructor, and assignments
+    //
+    // The compiler synthesized copy and move constructors, and copy and move assignment operators work just fine.
+    GapBuffer() = default;
+
+
+    // Queries
+    std::size_t size    () const noexcept { return _storage.size() - gapSize(); }
+    std::size_t capacity() const noexcept { return _storage.size();             }
+    bool        empty   () const noexcept { return size() == 0;                 }
+
+
+    // Accessors
+    T const & operator[]( std::size_t position ) const noexcept { return _storage[ physical( position ) ]; }
+    T       & operator[]( std::size_t position )       noexcept { return _storage[ physical( position ) ]; }
+
+    iterator       begin ()       noexcept { return { this, 0      }; }
+    iterator       end   ()       noexcept { return { this, size() }; }
+    const_iterator begin () const noexcept { return { this, 0      }; }
+    const_iterator end   () const noexcept { return { this, size() }; }
+    const_iterator cbegin() const noexcept { return begin();          }
+    const_iterator cend  () const noexcept { return end();            }
+
+    std::pair<std::span<T const>, std::span<T const>> segments() const noexcept                   // the elements before and after the gap, each contiguous
+    {
+      return { std::span<T const>( _storage.data(),            _gapBegin                    ),
+               std::span<T const>( _storage.data() + _gapEnd,  _storage.size() - _gapEnd    ) };
+    }
+
+
+    // Modifiers
+    template<typename U>
+    void insert( std::size_t position, U && value )                                               // inserts before the element currently at position
+    {
+      if( gapSize() == 0 )   grow( position );
+      else                   moveGap( position );
+      _storage[_gapBegin++] = std::forward<U>( value );
+    }
+
+    void erase( std::size_t position )
+    {
+      moveGap( position );
+      _storage[_gapEnd++] = T{};                                                                  // release the erased element's resources now
+    }
+
+    void clear() noexcept
+    {
+      _storage.clear();
+      _gapBegin = _gapEnd = 0;
+    }
+
+
+  private:
+    // Helper member functions
+    std::size_t gapSize ()                     const noexcept { return _gapEnd - _gapBegin;                                 }
+    std::size_t physical( std::size_t logical ) const noexcept { return logical < _gapBegin ? logical : logical + gapSize(); }
+
+    void moveGap( std::size_t position )                                                          // places the gap immediately before the element at position
+    {
+      if( position < _gapBegin )                                                                  // shift [position, gapBegin) to the far side of the gap
+      {
+        std::move_backward( _storage.begin() + position, _storage.begin() + _gapBegin, _storage.begin() + _gapEnd );
+        _gapEnd  -= _gapBegin - position;
+        _gapBegin = position;
+      }
+      else if( position > _gapBegin )                                                             // shift the elements just past the gap to its near side
+      {
+        auto count = position - _gapBegin;
+        std::move( _storage.begin() + _gapEnd, _storage.begin() + _gapEnd + count, _storage.begin() + _gapBegin );
+        _gapBegin += count;
+        _gapEnd   += count;
+      }
+    }
+
+    void grow( std::size_t position )                                                             // doubles capacity, leaving the new gap at position
+    {
+      auto           oldSize  = size();
+      std::vector<T> storage( std::max<std::size_t>( 2 * _storage.size(), 16 ) );
+      auto           newGapEnd = storage.size() - ( oldSize - position );
+
+      for( std::size_t i = 0; i < position; ++i )         storage[i]                         = std::move( ( *this )[i] );
+      for( std::size_t i = position; i < oldSize; ++i )   storage[newGapEnd + ( i - position )] = std::move( ( *this )[i] );
+
+      _storage  = std::move( storage );
+      _gapBegin = position;
+      _gapEnd   = newGapEnd;
+    }
+
+    // Instance Attributes
+    std::vector<T> _storage;                                                                      // elements and gap, gap occupies [_gapBegin, _gapEnd)
+    std::size_t    _gapBegin = 0;
+    std::size_t    _gapEnd   = 0;
+};
@@ -0,0 +1,297 @@
+#include <algorithm>                                                        // find(), max()
+#include <compare>                                                          // weak_ordering
+#include <cstddef>                                                          // size_t
+#include <format>                                                           // format()
+#include <functional>                                                       // hash
+#include <initializer_list>                                                 // initializer_list
+#include <iomanip>                                                          // setw()
+#include <iostream>                                                         // istream, ostream
+#include <utility>                                                          // move()
+
+#include "BloomFilter.hpp"
+#include "GapBufferGroceryList.hpp"
+#include "GroceryItem.hpp"
+#include "GroceryList.hpp"
+
+
+
+
+
+
+
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Constructors and Destructors
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Initializer List Constructor
+GapBufferGroceryList::GapBufferGroceryList( std::initializer_list<GroceryItem> const & initList )
+{
+  for( auto && groceryItem : initList )   insert( groceryItem, Position::BOTTOM );
+}
+
+
+
+
+
+
+
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Queries
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// size() const
+std::size_t GapBufferGroceryList::size() const noexcept
+{
+  return _items.size();
+}
+
+
+
+
+
+
+
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Accessors
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// find() const
+std::size_t GapBufferGroceryList::find( GroceryItem const & groceryItem ) const
+{
+  // Scan the contiguous segments on either side of the gap rather than paying for the gap check on every element
+  auto [front, back] = _items.segments();
+
+  auto match = std::find( front.begin(), front.end(), groceryItem );
+  if( match != front.end() )   return static_cast<std::size_t>( match - front.begin() );
+
+  match = std::find( back.begin(), back.end(), groceryItem );
+  return front.size() + static_cast<std::size_t>( match - back.begin() ); // size() if not found
+}
+
+
+
+// at() const
+GroceryItem const & GapBufferGroceryList::at( std::size_t offsetFromTop ) const
+{
+  if( offsetFromTop >= size() )   throw InvalidOffset_Ex( std::format( "Access position beyond end of current list size\n  position:     {:>2}\n  current size: {:>2}", offsetFromTop, size() ) );
+  return _items[offsetFromTop];
+}
+
+
+
+// begin() const
+GapBufferGroceryList::const_iterator GapBufferGroceryList::begin() const noexcept
+{
+  return _items.begin();
+}
+
+
+
+// end() const
+GapBufferGroceryList::const_iterator GapBufferGroceryList::end() const noexcept
+{
+  return _items.end();
+}
+
+
+
+
+
+
+
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Modifiers
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// insert( position )
+void GapBufferGroceryList::insert( GroceryItem const & groceryItem, Position position )
+{
+  if( position == Position::TOP )   insert( groceryItem, 0      );
+  else                              insert( groceryItem, size() );
+}
+
+
+
+// insert( offset )
+void GapBufferGroceryList::insert( GroceryItem const & groceryItem, std::size_t offsetFromTop )
+{
+  if( offsetFromTop > size() )   throw InvalidOffset_Ex( std::format( "Insertion position beyond end of current list size\n  position:     {:>2}\n  current size: {:>2}", offsetFromTop, size() ) );
+
+  // Prevent duplicate entries, scanning only when the filter can't rule the grocery item out
+  auto identity = std::hash<GroceryItem>{}( groceryItem );
+  if( _duplicateFilter.mayContain( identity ) && find( groceryItem ) != size() )   return;
+
+  if( _duplicateFilter.size() >= _duplicateFilter.capacity() )   rebuildDuplicateFilter();
+  _duplicateFilter.insert( identity );
+
+  _items.insert( offsetFromTop, groceryItem );
+}
+
+
+
+// remove( groceryItem )
+void GapBufferGroceryList::remove( GroceryItem const & groceryItem )
+{
+  remove( find( groceryItem ) );
+}
+
+
+
+// remove( offset )
+void GapBufferGroceryList::remove( std::size_t offsetFromTop )
+{
+  if( offsetFromTop >= size() )   return;
+
+  _items.erase( offsetFromTop );
+  if( ++_duplicateFilterRemovals > _duplicateFilter.size() / 2 )   rebuildDuplicateFilter();
+}
+
+
+
+// moveToTop()
+void GapBufferGroceryList::moveToTop( GroceryItem const & groceryItem )
+{
+  auto offset = find( groceryItem );
+  if( offset != size() )
+  {
+    remove( offset );
+    insert( groceryItem, Position::TOP );
+  }
+}
+
+
+
+// operator+=( initializer_list )
+GapBufferGroceryList & GapBufferGroceryList::operator+=( std::initializer_list<GroceryItem> const & rhs )
+{
+  for( auto && groceryItem : rhs )   insert( groceryItem, Position::BOTTOM );
+  return *this;
+}
+
+
+
+// operator+=( GapBufferGroceryList )
+GapBufferGroceryList & GapBufferGroceryList::operator+=( GapBufferGroceryList const & rhs )
+{
+  if( this == &rhs )   return *this;                                        // every grocery item would be a duplicate
+  for( auto && groceryItem : rhs )   insert( groceryItem, Position::BOTTOM );
+  return *this;
+}
+
+
+
+
+
+
+
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Relational Operators
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// operator<=>
+std::weak_ordering GapBufferGroceryList::operator<=>( GapBufferGroceryList const & rhs ) const
+{
+  auto commonSize = std::min( size(), rhs.size() );
+  for( std::size_t i = 0; i < commonSize; ++i )
+  {
+    auto cmp = _items[i] <=> rhs._items[i];
+    if( cmp != 0 )   return cmp;
+  }
+  return size() <=> rhs.size();
+}
+
+
+
+// operator==
+bool GapBufferGroceryList::operator==( GapBufferGroceryList const & rhs ) const
+{
+  if( size() != rhs.size() )   return false;
+  for( std::size_t i = 0; i < size(); ++i )   if( _items[i] != rhs._items[i] )   return false;
+  return true;
+}
+
+
+
+
+
+
+
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private member functions
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// rebuildDuplicateFilter()
+void GapBufferGroceryList::rebuildDuplicateFilter()
+{
+  BloomFilter filter( std::max<std::size_t>( 64, 2 * size() ), _duplicateFilter.falsePositiveRate() );
+  for( auto && groceryItem : _items )   filter.insert( std::hash<GroceryItem>{}( groceryItem ) );
+
+  _duplicateFilter         = std::move( filter );
+  _duplicateFilterRemovals = 0;
+}
+
+
+
+
+
+
+
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Non-member functions
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// operator<<
+std::ostream & operator<<( std::ostream & stream, GapBufferGroceryList const & groceryList )
+{
+  // Same layout as GroceryList's insertion operator
+  unsigned count = 0;
+  for( auto && groceryItem : groceryList )   stream << '\n' << std::setw(5) << count++ << ":  " << groceryItem;
+
+  return stream;
+}
+
+
+
+// operator>>
+std::istream & operator>>( std::istream & stream, GapBufferGroceryList & groceryList )
+{
+  GroceryItem temp;
+  while( stream >> temp )   groceryList.insert( temp, GapBufferGroceryList::Position::BOTTOM );
+
+  return stream;
+}
@@ -0,0 +1,78 @@
+#pragma once                                                                                      // include guard
+
+#include <compare>                                                                                // weak_ordering
+#include <cstddef>                                                                                // size_t
+#include <initializer_list>                                                                       // initializer_list
+#include <iostream>                                                                               // istream, ostream
+
+#include "BloomFilter.hpp"
+#include "GapBuffer.hpp"
+#include "GroceryItem.hpp"
+#include "GroceryList.hpp"
+
+
+// A GapBufferGroceryList offers GroceryList's interface over a single contiguous gap buffer.  GroceryList::insert() defaults to
+// Position::TOP and moveToTop() always inserts at offset 0, yet a vector (or array) shifts every existing grocery item on each top
+// insertion.  Here the gap parks at the top after such an insertion, so the next one is amortized O(1).  find() scans at most two
+// contiguous segments, and a Bloom filter lets most insertions of new grocery items skip the duplicate scan entirely.
+//
+// Unlike GroceryList, there is no fixed capacity.
+class GapBufferGroceryList
+{
+  // Insertion and Extraction Operators
+  friend std::ostream & operator<<( std::ostream & stream, GapBufferGroceryList const & groceryList );
+  friend std::istream & operator>>( std::istream & stream, GapBufferGroceryList       & groceryList );
+
+  public:
+    // Types and Exceptions
+    using Position         = GroceryList::Position;
+    using InvalidOffset_Ex = GroceryList::InvalidOffset_Ex;
+    using const_iterator   = GapBuffer<GroceryItem>::const_iterator;
+
+
+    // Constructors, destructor, and assignments
+    //
+    // The compiler synthesized copy and move constructors, and copy and move assignment operators work just fine.
+    GapBufferGroceryList() = default;                                                             // constructs an empty grocery list
+    GapBufferGroceryList( std::initializer_list<GroceryItem> const & initList );                  // constructs a grocery list from a braced list of grocery items
+
+
+    // Queries
+    std::size_t size() const noexcept;
+
+
+    // Accessors
+    std::size_t         find ( GroceryItem const & groceryItem ) const;                           // returns size() if grocery item not found
+    GroceryItem const & at   ( std::size_t offsetFromTop       ) const;                           // throws InvalidOffset_Ex if offsetFromTop >= size()
+
+    const_iterator      begin() const noexcept;
+    const_iterator      end  () const noexcept;
+
+
+    // Modifiers
+    void insert   ( GroceryItem const & groceryItem, Position    position = Position::TOP );      // amortized O(1) at the top
+    void insert   ( GroceryItem const & groceryItem, std::size_t offsetFromTop            );      // inserts before the grocery item currently at that offset
+
+    void remove   ( GroceryItem const & groceryItem                                       );      // no change occurs if grocery item not found
+    void remove   ( std::size_t         offsetFromTop                                     );      // no change occurs if (zero-based) offsetFromTop >= size()
+
+    void moveToTop( GroceryItem const & groceryItem                                       );
+
+    GapBufferGroceryList & operator+=( std::initializer_list<GroceryItem> const & rhs );
+    GapBufferGroceryList & operator+=( GapBufferGroceryList               const & rhs );
+
+
+    // Relational Operators
+    std::weak_ordering operator<=>( GapBufferGroceryList const & rhs ) const;
+    bool               operator== ( GapBufferGroceryList const & rhs ) const;
+
+
+  private:
+    // Helper member functions
+    void rebuildDuplicateFilter();
+
+    // Instance Attributes
+    GapBuffer<GroceryItem> _items;
+    BloomFilter            _duplicateFilter;                                                      // may hold removed grocery items, never misses a present one
+    std::size_t            _duplicateFilterRemovals = 0;
+};
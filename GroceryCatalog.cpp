@@ -0,0 +1,728 @@
+#include <algorithm>                                                        // lower_bound(), upper_bound(), max(), clamp()
+#include <array>                                                            // array
+#include <compare>                                                          // is_eq()
+#include <cstddef>                                                          // size_t, ptrdiff_t, byte
+#include <cstdint>                                                          // uint8_t, uint16_t, uint32_t, uint64_t
+#include <cstring>                                                          // memcpy()
+#include <filesystem>                                                       // path, exists(), file_size()
+#include <format>                                                           // format()
+#include <fstream>                                                          // fstream, ofstream
+#include <iostream>                                                         // istream, ostream, streamsize
+#include <iterator>                                                         // make_move_iterator(), next()
+#include <optional>                                                         // optional, nullopt
+#include <string>                                                           // string
+#include <string_view>                                                      // string_view
+#include <system_error>                                                     // system_error, errc
+#include <utility>                                                          // move(), pair
+#include <vector>                                                           // vector
+
+#include "GroceryCatalog.hpp"
+#include "GroceryItem.hpp"
+#include "GroceryList.hpp"
+
+
+
+
+
+
+
+
+
+
+
+/*******************************************************************************
+**  Implementation of non-member private types, objects, and functions
+*******************************************************************************/
+namespace    // unnamed, anonymous namespace
+{
+  constexpr std::uint64_t MAGIC          = 0x0031'5441'434F'5247ULL;        // "GROCAT1" read little endian
+  constexpr std::uint32_t LAYOUT_VERSION = 1;
+
+  constexpr std::size_t   NODE_HEADER_SIZE = 1 + 1 + 2 + 4 + 4;             // kind, reserved, count, prev, next
+  constexpr std::size_t   ITEM_HEADER_SIZE = 2 + 2 + 2 + 8;                 // three string lengths, price
+
+
+
+  // The catalog's header, stored at the start of page 0
+  struct Meta
+  {
+    std::uint64_t magic;
+    std::uint32_t layoutVersion;
+    std::uint32_t pageSize;
+    std::uint32_t root;
+    std::uint32_t pageCount;
+    std::uint32_t freeHead;
+    std::uint32_t reserved;
+    std::uint64_t size;
+  };
+
+
+
+  // Sequential encoding into, and bounds checked decoding out of, one page's bytes
+  struct Encoder
+  {
+    std::byte * position;
+
+    template<typename T>
+    void put( T value )                     { std::memcpy( position, &value, sizeof( value ) );  position += sizeof( value ); }
+    void put( std::string const & text )    { std::memcpy( position, text.data(), text.size() );  position += text.size(); }
+  };
+
+  struct Decoder
+  {
+    std::byte const * position;
+    std::byte const * end;
+
+    void require( std::size_t bytes ) const
+    {
+      if( static_cast<std::size_t>( end - position ) < bytes )   throw GroceryList::InvalidInternalState_Ex( "GroceryCatalog page is corrupt, its contents overrun the page" );
+    }
+
+    template<typename T>
+    T get()                                 { require( sizeof( T ) );  T value;  std::memcpy( &value, position, sizeof( value ) );  position += sizeof( value );  return value; }
+    std::string get( std::size_t length )   { require( length );  std::string text( reinterpret_cast<char const *>( position ), length );  position += length;  return text; }
+  };
+
+
+
+  [[noreturn]] void throwIoError( std::string_view what, std::filesystem::path const & path )
+  {
+    throw std::system_error( std::make_error_code( std::errc::io_error ), std::format( "GroceryCatalog failed to {} \"{}\"", what, path.string() ) );
+  }
+}    // unnamed, anonymous namespace
+
+
+
+
+
+
+
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Constructors and Destructors
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Path Constructor
+GroceryCatalog::GroceryCatalog( std::filesystem::path const & path, std::size_t cachePages )
+  : _path( path ), _cachePages( std::max<std::size_t>( cachePages, 16 ) )   // an operation briefly needs a few pages per tree level
+{
+  bool fresh = !std::filesystem::exists( _path ) || std::filesystem::file_size( _path ) == 0;
+  if( fresh && !std::ofstream( _path, std::ios::binary ) )   throwIoError( "create", _path );
+
+  _file.open( _path, std::ios::binary | std::ios::in | std::ios::out );
+  if( !_file )   throwIoError( "open", _path );
+
+  if( fresh )
+  {
+    _pageCount = META_PAGE + 1;
+    _root      = allocate( Node::Kind::LEAF );
+    flush();
+    return;
+  }
+
+  std::array<std::byte, PAGE_SIZE> buffer{};
+  _file.seekg( 0 );
+  if( !_file.read( reinterpret_cast<char *>( buffer.data() ), PAGE_SIZE ) )   throwIoError( "read the header of", _path );
+
+  Meta meta;
+  std::memcpy( &meta, buffer.data(), sizeof( meta ) );
+  if( meta.magic != MAGIC )   throw GroceryList::InvalidInternalState_Ex( std::format( "\"{}\" is not a grocery catalog", _path.string() ) );
+  if( meta.layoutVersion != LAYOUT_VERSION || meta.pageSize != PAGE_SIZE || meta.root >= meta.pageCount )
+  {
+    throw GroceryList::InvalidInternalState_Ex( std::format( "\"{}\" has an incompatible or corrupt layout", _path.string() ) );
+  }
+
+  _root      = meta.root;
+  _pageCount = meta.pageCount;
+  _freeHead  = meta.freeHead;
+  _size      = meta.size;
+}
+
+
+
+// Destructor
+GroceryCatalog::~GroceryCatalog() noexcept
+{
+  try                 { flush(); }
+  catch( ... )        {}                                                    // destructors must not throw, call flush() explicitly to observe errors
+}
+
+
+
+
+
+
+
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Queries
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// size() const
+std::size_t GroceryCatalog::size() const noexcept
+{
+  return _size;
+}
+
+
+
+// pageCount() const
+std::size_t GroceryCatalog::pageCount() const noexcept
+{
+  return _pageCount;
+}
+
+
+
+// cacheStats() const
+GroceryCatalog::CacheStats GroceryCatalog::cacheStats() const noexcept
+{
+  return _cacheStats;
+}
+
+
+
+
+
+
+
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Accessors
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// find() const
+std::optional<GroceryItem> GroceryCatalog::find( GroceryItem const & groceryItem ) const
+{
+  // seek() lands in the one leaf that could hold the grocery item, so if it isn't at the position found it isn't anywhere
+  auto [leaf, index] = seek( &groceryItem );
+  auto const & node  = page( leaf );
+
+  std::optional<GroceryItem> result;
+  if( index < node.keys.size() && std::is_eq( node.keys[index] <=> groceryItem ) )   result = node.keys[index];
+
+  trimCache();
+  return result;
+}
+
+
+
+// contains() const
+bool GroceryCatalog::contains( GroceryItem const & groceryItem ) const
+{
+  return find( groceryItem ).has_value();
+}
+
+
+
+// range() const
+std::vector<GroceryItem> GroceryCatalog::range( GroceryItem const & lower, GroceryItem const & upper ) const
+{
+  std::vector<GroceryItem> result;
+  scan( lower, upper, [&]( GroceryItem const & groceryItem ) { result.push_back( groceryItem ); } );
+  return result;
+}
+
+
+
+
+
+
+
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Modifiers
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// insert()
+bool GroceryCatalog::insert( GroceryItem const & groceryItem )
+{
+  if( encodedSize( groceryItem ) > MAX_ITEM_SIZE )
+  {
+    throw GroceryList::CapacityExceeded_Ex( std::format( "Grocery item too large for a catalog page, size: {}, limit: {}", encodedSize( groceryItem ), MAX_ITEM_SIZE ) );
+  }
+
+  bool inserted = false;
+  if( auto split = insertInto( _root, groceryItem, inserted ) )
+  {
+    // The root split, so the tree grows a level
+    auto   newRoot = allocate( Node::Kind::INTERNAL );
+    auto & node    = pageForWrite( newRoot );
+    node.keys.push_back( std::move( split->separator ) );
+    node.children = { _root, split->right };
+    _root = newRoot;
+  }
+
+  if( inserted )   ++_size;
+  trimCache();
+  return inserted;
+}
+
+
+
+// remove()
+bool GroceryCatalog::remove( GroceryItem const & groceryItem )
+{
+  bool removed = false;
+  bool emptied = removeFrom( _root, groceryItem, removed );
+
+  // An internal root left with no children starts over as an empty leaf, and one left with a single child hands the root down
+  if( emptied && page( _root ).kind == Node::Kind::INTERNAL )
+  {
+    release( _root );
+    _root = allocate( Node::Kind::LEAF );
+  }
+  while( page( _root ).kind == Node::Kind::INTERNAL && page( _root ).children.size() == 1 )
+  {
+    auto oldRoot = _root;
+    _root = page( oldRoot ).children.front();
+    release( oldRoot );
+  }
+
+  if( removed )   --_size;
+  trimCache();
+  return removed;
+}
+
+
+
+// flush()
+void GroceryCatalog::flush()
+{
+  for( auto & [id, entry] : _cache )
+  {
+    if( !entry.dirty )   continue;
+    writePage( id, entry.node );
+    entry.dirty = false;
+    ++_cacheStats.writes;
+  }
+  writeMeta();
+
+  if( !_file.flush() )   throwIoError( "flush", _path );
+}
+
+
+
+
+
+
+
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Import and Export
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// importFrom( GroceryList )
+std::size_t GroceryCatalog::importFrom( GroceryList const & groceryList )
+{
+  std::size_t count = 0;
+  for( auto && groceryItem : groceryList )   if( insert( groceryItem ) )   ++count;
+  return count;
+}
+
+
+
+// importFrom( istream )
+std::size_t GroceryCatalog::importFrom( std::istream & stream )
+{
+  std::size_t count = 0;
+  for( GroceryItem groceryItem; stream >> groceryItem; )   if( insert( groceryItem ) )   ++count;
+  return count;
+}
+
+
+
+// exportTo( GroceryList ) const
+void GroceryCatalog::exportTo( GroceryList & groceryList, GroceryItem const & lower, GroceryItem const & upper ) const
+{
+  for( auto & groceryItem : range( lower, upper ) )   groceryList.insert( std::move( groceryItem ), GroceryList::Position::BOTTOM );
+}
+
+
+
+// exportTo( ostream ) const
+void GroceryCatalog::exportTo( std::ostream & stream ) const
+{
+  scan( [&]( GroceryItem const & groceryItem ) { return static_cast<bool>( stream << groceryItem << '\n' ); } );
+}
+
+
+
+
+
+
+
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private member functions
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// page() const
+GroceryCatalog::Node const & GroceryCatalog::page( PageId id ) const
+{
+  if( auto cached = _cache.find( id );  cached != _cache.end() )
+  {
+    ++_cacheStats.hits;
+    _lru.splice( _lru.begin(), _lru, cached->second.recency );
+    return cached->second.node;
+  }
+
+  ++_cacheStats.misses;
+  Node node;
+  readPage( id, node );
+
+  // Cache entries are never evicted mid operation, so references handed out here stay valid until the next trimCache()
+  _lru.push_front( id );
+  try
+  {
+    return _cache.emplace( id, CacheEntry{ std::move( node ), false, _lru.begin() } ).first->second.node;
+  }
+  catch( ... )
+  {
+    _lru.pop_front();
+    throw;
+  }
+}
+
+
+
+// pageForWrite()
+GroceryCatalog::Node & GroceryCatalog::pageForWrite( PageId id )
+{
+  page( id );                                                               // brings it in and makes it most recently used
+  auto & entry = _cache.find( id )->second;
+  entry.dirty  = true;
+  return entry.node;
+}
+
+
+
+// allocate()
+GroceryCatalog::PageId GroceryCatalog::allocate( Node::Kind kind )
+{
+  PageId id;
+  if( _freeHead != NO_PAGE )
+  {
+    id        = _freeHead;
+    _freeHead = page( id ).next;
+  }
+  else
+  {
+    if( _pageCount == NO_PAGE )   throw GroceryList::CapacityExceeded_Ex( std::format( "Grocery catalog \"{}\" has no page numbers left", _path.string() ) );
+
+    // A brand new page lies beyond the end of the file, so there's nothing to read.  It's cached dirty and reaches the file when
+    // written back.
+    id = _pageCount;
+    _lru.push_front( id );
+    try                 { _cache.emplace( id, CacheEntry{ Node{}, true, _lru.begin() } ); }
+    catch( ... )        { _lru.pop_front();  throw; }
+    ++_pageCount;
+  }
+
+  auto & node = pageForWrite( id );
+  node      = Node{};
+  node.kind = kind;
+  return id;
+}
+
+
+
+// release()
+void GroceryCatalog::release( PageId id )
+{
+  auto & node = pageForWrite( id );
+  node      = Node{};
+  node.kind = Node::Kind::FREE;
+  node.next = _freeHead;
+  _freeHead = id;
+}
+
+
+
+// trimCache() const
+void GroceryCatalog::trimCache() const
+{
+  while( _cache.size() > _cachePages )
+  {
+    auto victim = _cache.find( _lru.back() );
+    if( victim->second.dirty )
+    {
+      writePage( victim->first, victim->second.node );
+      ++_cacheStats.writes;
+    }
+
+    _cache.erase( victim );
+    _lru.pop_back();
+    ++_cacheStats.evictions;
+  }
+}
+
+
+
+// readPage() const
+void GroceryCatalog::readPage( PageId id, Node & node ) const
+{
+  std::array<std::byte, PAGE_SIZE> buffer;
+
+  _file.clear();
+  _file.seekg( static_cast<std::streamoff>( id ) * static_cast<std::streamoff>( PAGE_SIZE ) );
+  if( !_file.read( reinterpret_cast<char *>( buffer.data() ), PAGE_SIZE ) )   throwIoError( std::format( "read page {} of", id ), _path );
+
+  Decoder decoder{ buffer.data(), buffer.data() + buffer.size() };
+  node.kind     = static_cast<Node::Kind>( decoder.get<std::uint8_t>() );
+  decoder.get<std::uint8_t>();                                              // reserved
+  auto count    = decoder.get<std::uint16_t>();
+  node.prev     = decoder.get<PageId>();
+  node.next     = decoder.get<PageId>();
+
+  if( node.kind != Node::Kind::FREE && node.kind != Node::Kind::LEAF && node.kind != Node::Kind::INTERNAL )
+  {
+    throw GroceryList::InvalidInternalState_Ex( std::format( "GroceryCatalog page {} is corrupt, unknown page kind", id ) );
+  }
+
+  if( node.kind == Node::Kind::INTERNAL )
+  {
+    node.children.resize( count + std::size_t{ 1 } );
+    for( auto & child : node.children )   child = decoder.get<PageId>();
+  }
+
+  node.keys.reserve( count );
+  for( std::size_t i = 0; i < count; ++i )
+  {
+    auto upcLength     = decoder.get<std::uint16_t>();
+    auto brandLength   = decoder.get<std::uint16_t>();
+    auto productLength = decoder.get<std::uint16_t>();
+    auto price         = decoder.get<double>();
+    auto upcCode       = decoder.get( upcLength     );
+    auto brandName     = decoder.get( brandLength   );
+    auto productName   = decoder.get( productLength );
+    node.keys.emplace_back( std::move( productName ), std::move( brandName ), std::move( upcCode ), price );
+  }
+}
+
+
+
+// writePage() const
+void GroceryCatalog::writePage( PageId id, Node const & node ) const
+{
+  std::array<std::byte, PAGE_SIZE> buffer{};                                // zero fill, so unused bytes are deterministic
+
+  Encoder encoder{ buffer.data() };
+  encoder.put( static_cast<std::uint8_t >( node.kind        ) );
+  encoder.put( std::uint8_t{ 0 } );                                         // reserved
+  encoder.put( static_cast<std::uint16_t>( node.keys.size() ) );
+  encoder.put( node.prev );
+  encoder.put( node.next );
+
+  for( auto child : node.children )   encoder.put( child );
+
+  for( auto && key : node.keys )
+  {
+    encoder.put( static_cast<std::uint16_t>( key.upcCode    ().size() ) );
+    encoder.put( static_cast<std::uint16_t>( key.brandName  ().size() ) );
+    encoder.put( static_cast<std::uint16_t>( key.productName().size() ) );
+    encoder.put( key.price() );
+    encoder.put( key.upcCode    () );
+    encoder.put( key.brandName  () );
+    encoder.put( key.productName() );
+  }
+
+  _file.clear();
+  _file.seekp( static_cast<std::streamoff>( id ) * static_cast<std::streamoff>( PAGE_SIZE ) );
+  if( !_file.write( reinterpret_cast<char const *>( buffer.data() ), PAGE_SIZE ) )   throwIoError( std::format( "write page {} of", id ), _path );
+}
+
+
+
+// writeMeta() const
+void GroceryCatalog::writeMeta() const
+{
+  std::array<std::byte, PAGE_SIZE> buffer{};
+
+  Meta meta{ MAGIC, LAYOUT_VERSION, PAGE_SIZE, _root, _pageCount, _freeHead, 0, _size };
+  std::memcpy( buffer.data(), &meta, sizeof( meta ) );
+
+  _file.clear();
+  _file.seekp( static_cast<std::streamoff>( META_PAGE ) * static_cast<std::streamoff>( PAGE_SIZE ) );
+  if( !_file.write( reinterpret_cast<char const *>( buffer.data() ), PAGE_SIZE ) )   throwIoError( "write the header of", _path );
+}
+
+
+
+// insertInto()
+std::optional<GroceryCatalog::Split> GroceryCatalog::insertInto( PageId id, GroceryItem const & groceryItem, bool & inserted )
+{
+  // Splits at the first key that puts at least half the key bytes on the left.  Keys are at most a quarter page, so both halves of
+  // an overfull page fit.
+  auto splitPoint = []( std::vector<GroceryItem> const & keys )
+  {
+    std::size_t total = 0;
+    for( auto && key : keys )   total += encodedSize( key );
+
+    std::size_t left = 0, mid = 0;
+    while( mid < keys.size() && left < total / 2 )   left += encodedSize( keys[mid++] );
+    return std::clamp<std::size_t>( mid, 1, keys.size() - 1 );
+  };
+
+
+  if( page( id ).kind == Node::Kind::LEAF )
+  {
+    auto const & leaf     = page( id );
+    auto         position = std::lower_bound( leaf.keys.begin(), leaf.keys.end(), groceryItem );
+    if( position != leaf.keys.end() && std::is_eq( *position <=> groceryItem ) )   return std::nullopt;   // silently discard duplicates
+
+    auto offset = position - leaf.keys.begin();
+    auto & node = pageForWrite( id );
+    node.keys.insert( std::next( node.keys.begin(), offset ), groceryItem );
+    inserted = true;
+
+    if( encodedSize( node ) <= PAGE_SIZE )   return std::nullopt;
+
+    // Overfull, move the upper half to a new right sibling
+    auto   mid     = static_cast<std::ptrdiff_t>( splitPoint( node.keys ) );
+    auto   rightId = allocate( Node::Kind::LEAF );
+    auto & right   = pageForWrite( rightId );
+
+    right.keys.assign( std::make_move_iterator( std::next( node.keys.begin(), mid ) ), std::make_move_iterator( node.keys.end() ) );
+    node.keys.erase( std::next( node.keys.begin(), mid ), node.keys.end() );
+
+    right.prev = id;
+    right.next = node.next;
+    if( node.next != NO_PAGE )   pageForWrite( node.next ).prev = rightId;
+    node.next  = rightId;
+
+    return Split{ right.keys.front(), rightId };
+  }
+
+
+  // Internal node:  descend to the child whose range holds the grocery item (keys equal to a separator live to its right)
+  auto const & internal   = page( id );
+  auto         childIndex = std::upper_bound( internal.keys.begin(), internal.keys.end(), groceryItem ) - internal.keys.begin();
+  auto         child      = internal.children[static_cast<std::size_t>( childIndex )];
+
+  auto split = insertInto( child, groceryItem, inserted );
+  if( !split )   return std::nullopt;
+
+  auto & node = pageForWrite( id );
+  node.keys    .insert( std::next( node.keys    .begin(), childIndex     ), std::move( split->separator ) );
+  node.children.insert( std::next( node.children.begin(), childIndex + 1 ), split->right                  );
+
+  if( encodedSize( node ) <= PAGE_SIZE )   return std::nullopt;
+
+  // Overfull, the middle key moves up and the keys and children above it move to a new right sibling
+  auto   mid     = static_cast<std::ptrdiff_t>( splitPoint( node.keys ) );
+  auto   rightId = allocate( Node::Kind::INTERNAL );
+  auto & right   = pageForWrite( rightId );
+
+  auto separator = std::move( node.keys[static_cast<std::size_t>( mid )] );
+  right.keys    .assign( std::make_move_iterator( std::next( node.keys.begin(), mid + 1 ) ), std::make_move_iterator( node.keys.end() ) );
+  right.children.assign( std::next( node.children.begin(), mid + 1 ), node.children.end() );
+  node.keys    .erase( std::next( node.keys    .begin(), mid     ), node.keys    .end() );
+  node.children.erase( std::next( node.children.begin(), mid + 1 ), node.children.end() );
+
+  return Split{ std::move( separator ), rightId };
+}
+
+
+
+// removeFrom()
+bool GroceryCatalog::removeFrom( PageId id, GroceryItem const & groceryItem, bool & removed )
+{
+  if( page( id ).kind == Node::Kind::LEAF )
+  {
+    auto const & leaf     = page( id );
+    auto         position = std::lower_bound( leaf.keys.begin(), leaf.keys.end(), groceryItem );
+    if( position == leaf.keys.end() || !std::is_eq( *position <=> groceryItem ) )   return false;
+
+    auto offset = position - leaf.keys.begin();
+    auto & node = pageForWrite( id );
+    node.keys.erase( std::next( node.keys.begin(), offset ) );
+    removed = true;
+
+    return node.keys.empty();
+  }
+
+
+  auto const & internal   = page( id );
+  auto         childIndex = std::upper_bound( internal.keys.begin(), internal.keys.end(), groceryItem ) - internal.keys.begin();
+  auto         child      = internal.children[static_cast<std::size_t>( childIndex )];
+
+  if( !removeFrom( child, groceryItem, removed ) )   return false;
+
+  // The child emptied.  Unlink an empty leaf from its siblings, release the child's page, and drop the separator that bounded it
+  // (the one below it, or above it for the first child) so its neighbor absorbs its key range.
+  if( auto const & emptied = page( child );  emptied.kind == Node::Kind::LEAF )
+  {
+    auto prev = emptied.prev, next = emptied.next;
+    if( prev != NO_PAGE )   pageForWrite( prev ).next = next;
+    if( next != NO_PAGE )   pageForWrite( next ).prev = prev;
+  }
+  release( child );
+
+  auto & node = pageForWrite( id );
+  node.children.erase( std::next( node.children.begin(), childIndex ) );
+  if( !node.keys.empty() )   node.keys.erase( std::next( node.keys.begin(), childIndex > 0 ? childIndex - 1 : 0 ) );
+
+  return node.children.empty();
+}
+
+
+
+// seek() const
+std::pair<GroceryCatalog::PageId, std::size_t> GroceryCatalog::seek( GroceryItem const * lower ) const
+{
+  for( auto id = _root;; )
+  {
+    auto const & node = page( id );
+    if( node.kind == Node::Kind::LEAF )
+    {
+      auto index = lower == nullptr ? 0 : std::lower_bound( node.keys.begin(), node.keys.end(), *lower ) - node.keys.begin();
+      return { id, static_cast<std::size_t>( index ) };
+    }
+
+    auto childIndex = lower == nullptr ? 0 : std::upper_bound( node.keys.begin(), node.keys.end(), *lower ) - node.keys.begin();
+    id = node.children[static_cast<std::size_t>( childIndex )];
+  }
+}
+
+
+
+// encodedSize( GroceryItem )
+std::size_t GroceryCatalog::encodedSize( GroceryItem const & groceryItem ) noexcept
+{
+  return ITEM_HEADER_SIZE + groceryItem.upcCode().size() + groceryItem.brandName().size() + groceryItem.productName().size();
+}
+
+
+
+// encodedSize( Node )
+std::size_t GroceryCatalog::encodedSize( Node const & node ) noexcept
+{
+  auto size = NODE_HEADER_SIZE + node.children.size() * sizeof( PageId );
+  for( auto && key : node.keys )   size += encodedSize( key );
+  return size;
+}
@@ -0,0 +1,215 @@
+#pragma once                                                                                      // include guard
+
+#include <cstddef>                                                                                // size_t
+#include <cstdint>                                                                                // uint8_t, uint32_t
+#include <filesystem>                                                                             // path
+#include <fstream>                                                                                // fstream
+#include <iostream>                                                                               // istream, ostream
+#include <limits>                                                                                 // numeric_limits
+#include <list>
+#include <optional>                                                                               // optional
+#include <type_traits>                                                                            // is_same_v, invoke_result_t
+#include <unordered_map>
+#include <utility>                                                                                // pair
+#include <vector>
+
+#include "GroceryItem.hpp"
+#include "GroceryList.hpp"
+
+
+// A GroceryCatalog is an ordered collection of distinct grocery items kept in a file rather than in memory, for catalogs larger than
+// any process wants resident.  Grocery items are kept in a B+-tree of fixed size pages ordered by GroceryItem's three-way comparison
+// (UPC, product name, brand name, then price), so finds, inserts, and removes touch one page per level and ordered range scans walk
+// the linked leaf pages.  At most a bounded number of pages are held in memory at once:  the least recently used clean page is
+// dropped, or dirty page written back, when an operation needs room.
+//
+// Removes don't merge underfull pages, they only release pages that become empty.  Exporting and re-importing compacts a catalog
+// that has seen heavy removal.  Changes reach the file when pages are evicted, at flush(), and on destruction; a catalog is not
+// crash safe.  Pages are stored in the host's byte order.  A catalog is not safe to use from more than one thread at a time, even
+// for finds, because finds update the page cache.
+class GroceryCatalog
+{
+  public:
+    // Types
+    struct CacheStats
+    {
+      std::size_t hits      = 0;                                                                  // page requests satisfied from memory
+      std::size_t misses    = 0;                                                                  // page requests read from the file
+      std::size_t evictions = 0;                                                                  // pages dropped to stay within the cache bound
+      std::size_t writes    = 0;                                                                  // dirty pages written back to the file
+    };
+
+    static constexpr std::size_t PAGE_SIZE           = 4096;
+    static constexpr std::size_t MAX_ITEM_SIZE       = PAGE_SIZE / 4;                             // encoded size limit, so any half of a full page fits in a page
+    static constexpr std::size_t DEFAULT_CACHE_PAGES = 256;
+
+
+    // Constructors, destructor, and assignments
+    //
+    // A catalog owns its open file, so catalogs can be neither copied nor moved.
+    explicit GroceryCatalog( std::filesystem::path const & path, std::size_t cachePages = DEFAULT_CACHE_PAGES );   // opens the catalog at path, creating an empty one if none exists
+
+    GroceryCatalog            ( GroceryCatalog const & ) = delete;
+    GroceryCatalog & operator=( GroceryCatalog const & ) = delete;
+   ~GroceryCatalog() noexcept;                                                                    // flushes, call flush() explicitly to observe errors
+
+
+    // Queries
+    std::size_t size      () const noexcept;                                                      // number of grocery items in the catalog
+    std::size_t pageCount () const noexcept;                                                      // file size in pages, including released pages awaiting reuse
+    CacheStats  cacheStats() const noexcept;
+
+
+    // Accessors
+    std::optional<GroceryItem> find    ( GroceryItem const & groceryItem ) const;                 // the stored grocery item comparing equivalent, if any
+    bool                       contains( GroceryItem const & groceryItem ) const;
+
+    std::vector<GroceryItem>   range   ( GroceryItem const & lower, GroceryItem const & upper ) const;   // grocery items in [lower, upper), in order
+
+    template<typename Visitor>
+    void scan( Visitor && visitor ) const;                                                        // visitor( GroceryItem const & ) for every grocery item in order, stops early if it returns false
+    template<typename Visitor>
+    void scan( GroceryItem const & lower, GroceryItem const & upper, Visitor && visitor ) const;  // same, restricted to [lower, upper)
+
+
+    // Modifiers
+    bool insert( GroceryItem const & groceryItem );                                               // false (and no change) if an equivalent grocery item is already present
+    bool remove( GroceryItem const & groceryItem );                                               // false if no equivalent grocery item is present
+    void flush ();                                                                                // writes every dirty page and the catalog's header page
+
+
+    // Import and Export
+    std::size_t importFrom( GroceryList const & groceryList );                                    // inserts each grocery item, returns how many were new
+    std::size_t importFrom( std::istream      & stream      );                                    // reads GroceryItem text to end of file, returns how many were new
+
+    void exportTo( GroceryList  & groceryList, GroceryItem const & lower, GroceryItem const & upper ) const;   // appends [lower, upper) to the bottom, GroceryList's capacity limits apply
+    void exportTo( std::ostream & stream                                                           ) const;   // writes every grocery item as GroceryItem text, one per line
+
+
+  private:
+    // Types
+    using PageId = std::uint32_t;
+
+    static constexpr PageId NO_PAGE   = std::numeric_limits<PageId>::max();
+    static constexpr PageId META_PAGE = 0;                                                        // the catalog's header, never a tree node
+
+    struct Node                                                                                   // a page, decoded
+    {
+      enum class Kind : std::uint8_t { FREE, LEAF, INTERNAL };
+
+      Kind                     kind = Kind::LEAF;
+      std::vector<GroceryItem> keys;                                                              // grocery items in a leaf, separators in an internal node
+      std::vector<PageId>      children;                                                          // internal nodes only, one more than there are keys
+      PageId                   prev = NO_PAGE;                                                    // leaf siblings in key order
+      PageId                   next = NO_PAGE;                                                    // also chains released pages together
+    };
+
+    struct CacheEntry
+    {
+      Node                        node;
+      bool                        dirty = false;
+      std::list<PageId>::iterator recency;                                                        // position in _lru
+    };
+
+    struct Split                                                                                  // a node's new right sibling, and the key separating them
+    {
+      GroceryItem separator;
+      PageId      right;
+    };
+
+    // Helper member functions
+    Node const & page        ( PageId id ) const;                                                 // brings the page into the cache and marks it most recently used
+    Node       & pageForWrite( PageId id );                                                       // same, and marks it dirty
+    PageId       allocate    ( Node::Kind kind );
+    void         release     ( PageId id );
+    void         trimCache   () const;                                                            // evicts down to the cache bound, called between operations so no node in use is evicted
+
+    void readPage ( PageId id, Node       & node ) const;
+    void writePage( PageId id, Node const & node ) const;
+    void writeMeta() const;
+
+    std::optional<Split>          insertInto( PageId id, GroceryItem const & groceryItem, bool & inserted );
+    bool                          removeFrom( PageId id, GroceryItem const & groceryItem, bool & removed  );   // true if the node was left empty
+    std::pair<PageId, std::size_t> seek     ( GroceryItem const * lower ) const;                  // first leaf position not less than lower, or the very first position
+
+    static std::size_t encodedSize( GroceryItem const & groceryItem ) noexcept;
+    static std::size_t encodedSize( Node        const & node        ) noexcept;
+
+    // Instance Attributes
+    std::filesystem::path _path;
+    mutable std::fstream  _file;
+    std::size_t           _cachePages;
+
+    PageId                _root      = NO_PAGE;
+    PageId                _pageCount = 0;
+    PageId                _freeHead  = NO_PAGE;                                                   // most recently released page
+    std::size_t           _size      = 0;
+
+    mutable std::unordered_map<PageId, CacheEntry> _cache;
+    mutable std::list<PageId>                      _lru;                                          // most recently used at the front
+    mutable CacheStats                             _cacheStats;
+};
+
+
+
+
+
+
+
+
+/*******************************************************************************
+**  Template definitions
+*******************************************************************************/
+
+// scan() const
+template<typename Visitor>
+void GroceryCatalog::scan( Visitor && visitor ) const
+{
+  auto [leaf, index] = seek( nullptr );
+  while( leaf != NO_PAGE )
+  {
+    // Copy out what's needed before trimming the cache, which may evict this page
+    auto const & node = page( leaf );
+    for( ; index < node.keys.size(); ++index )
+    {
+      if constexpr( std::is_same_v<std::invoke_result_t<Visitor &, GroceryItem const &>, bool> )
+      {
+        if( !visitor( node.keys[index] ) ) { trimCache();  return; }
+      }
+      else   visitor( node.keys[index] );
+    }
+
+    leaf  = node.next;
+    index = 0;
+    trimCache();
+  }
+}
+
+
+
+// scan( lower, upper ) const
+template<typename Visitor>
+void GroceryCatalog::scan( GroceryItem const & lower, GroceryItem const & upper, Visitor && visitor ) const
+{
+  if( !( lower < upper ) )   return;
+
+  auto [leaf, index] = seek( &lower );
+  while( leaf != NO_PAGE )
+  {
+    auto const & node = page( leaf );
+    for( ; index < node.keys.size(); ++index )
+    {
+      if( !( node.keys[index] < upper ) ) { trimCache();  return; }
+
+      if constexpr( std::is_same_v<std::invoke_result_t<Visitor &, GroceryItem const &>, bool> )
+      {
+        if( !visitor( node.keys[index] ) ) { trimCache();  return; }
+      }
+      else   visitor( node.keys[index] );
+    }
+
+    leaf  = node.next;
+    index = 0;
+    trimCache();
+  }
+}
@@ -1,46 +1,17 @@
-#include <algorithm>                                                  // max()
-#include <cmath>                                                      // abs(), pow()
 #include <compare>                                                    // weak_ordering
+#include <cstddef>                                                    // size_t
+#include <cstdint>                                                    // uint64_t
+#include <functional>                                                 // hash, less
 #include <iomanip>                                                    // quoted(), ios::failbit
 #include <iostream>                                                   // istream, ostream, ws()
+#include <optional>                                                   // optional, nullopt
 #include <string>
-#include <type_traits>                                                // is_floating_point_v, common_type_t
-#include <utility>                                                    // move()
+#include <utility>                                                    // move(), exchange()
 
 #include "GroceryItem.hpp"
 
 
 
-/*******************************************************************************
-**  Implementation of non-member private types, objects, and functions
-*******************************************************************************/
-namespace    // unnamed, anonymous namespace
-{
-  // Avoid direct equality comparisons on floating point numbers. Two values are equal if they are "close enough", which is
-  // represented by Epsilon.  Usually, this is a pretty small number, but since we are dealing with money (only two, maybe three
-  // decimal places) we need to be a bit more tolerant.
-  //
-  // The two values are "close enough" to be considered equal if the distance between lhs and rhs is less than:
-  // o)  EPSILON1, otherwise
-  // o)  EPSILON2 percentage of the larger value's magnitude
-
-  template< typename T,  typename U >   requires std::is_floating_point_v<std::common_type_t<U, T> >
-  constexpr bool floating_point_is_equal( T const lhs,  U const rhs,  long double const EPSILON1 = /*1e-12L*/ 1e-4L,  long double const EPSILON2 = 1e-8L ) noexcept
-  {
-    ///////////////////////// TO-DO (1) //////////////////////////////
-    auto diff    = std::abs(lhs - rhs);
-    auto largest = std::max(std::abs(lhs), std::abs(rhs));
-    return (diff <= EPSILON1) || (diff <= largest * EPSILON2);
-    /////////////////////// END-TO-DO (1) ////////////////////////////
-  }
-}    // unnamed, anonymous namespace
-
-
-
-
-
-
-
 /*******************************************************************************
 **  Constructors, assignments, and destructor
 *******************************************************************************/
@@ -56,6 +27,7 @@ GroceryItem::GroceryItem( std::string productName,
     _productName(std::move(productName)),
     _price(price)
 /////////////////////// END-TO-DO (2) ////////////////////////////
+  , _sortKey( makeSortKey( _upcCode, _productName, _brandName ) )     // declared after the strings, so they're already initialized
 {}                                                                    // Avoid setting values in constructor's body (when possible)
 
 
@@ -69,6 +41,7 @@ GroceryItem::GroceryItem( GroceryItem const & other )
     _productName( other._productName ),
     _price     ( other._price )
 /////////////////////// END-TO-DO (3) ////////////////////////////
+  , _sortKey   ( other._sortKey )
 {}                                                                    // Avoid setting values in constructor's body (when possible)
 
 
@@ -82,6 +55,7 @@ GroceryItem::GroceryItem( GroceryItem && other ) noexcept
     _productName( std::move(other._productName) ),
     _price     ( std::move(other._price) )
 /////////////////////// END-TO-DO (4) ////////////////////////////
+  , _sortKey   ( std::exchange( other._sortKey, std::nullopt ) )      // other's strings are now unspecified, so its key can't be trusted
 {}
 
 
@@ -97,6 +71,7 @@ GroceryItem & GroceryItem::operator=( GroceryItem const & rhs ) &
     _brandName  = rhs._brandName;
     _productName= rhs._productName;
     _price      = rhs._price;
+    _sortKey    = rhs._sortKey;
   }
   return *this;
   /////////////////////// END-TO-DO (5) ////////////////////////////
@@ -115,6 +90,7 @@ GroceryItem & GroceryItem::operator=( GroceryItem && rhs ) & noexcept
     _brandName  = std::move(rhs._brandName);
     _productName= std::move(rhs._productName);
     _price      = std::move(rhs._price);
+    _sortKey    = std::exchange( rhs._sortKey, std::nullopt );
   }
   return *this;
 }
@@ -185,6 +161,7 @@ double GroceryItem::price() const &
 ///////////////////////// TO-DO (12) //////////////////////////////
 std::string GroceryItem::upcCode() &&
 {
+  _sortKey.reset();                                                   // the string is about to be moved from
   return std::move(_upcCode);
 }
 /////////////////////// END-TO-DO (12) ////////////////////////////
@@ -196,6 +173,7 @@ std::string GroceryItem::upcCode() &&
 ///////////////////////// TO-DO (13) //////////////////////////////
 std::string GroceryItem::brandName() &&
 {
+  _sortKey.reset();                                                   // the string is about to be moved from
   return std::move(_brandName);
 }
 /////////////////////// END-TO-DO (13) ////////////////////////////
@@ -207,6 +185,7 @@ std::string GroceryItem::brandName() &&
 std::string GroceryItem::productName() &&
 {
   ///////////////////////// TO-DO (14) //////////////////////////////
+  _sortKey.reset();                                                   // the string is about to be moved from
   return std::move(_productName);
   /////////////////////// END-TO-DO (14) ////////////////////////////
 }
@@ -227,6 +206,7 @@ GroceryItem & GroceryItem::upcCode( std::string newUpcCode ) &
 {
   ///////////////////////// TO-DO (15) //////////////////////////////
   _upcCode = std::move(newUpcCode);
+  _sortKey = makeSortKey( _upcCode, _productName, _brandName );
   return *this;
   /////////////////////// END-TO-DO (15) ////////////////////////////
 }
@@ -239,6 +219,7 @@ GroceryItem & GroceryItem::upcCode( std::string newUpcCode ) &
 GroceryItem & GroceryItem::brandName( std::string newBrandName ) &
 {
   _brandName = std::move(newBrandName);
+  _sortKey = makeSortKey( _upcCode, _productName, _brandName );
   return *this;
 }
 /////////////////////// END-TO-DO (16) ////////////////////////////
@@ -251,6 +232,7 @@ GroceryItem & GroceryItem::productName( std::string newProductName ) &
 ///////////////////////// TO-DO (17) //////////////////////////////
 {
   _productName = std::move(newProductName);
+  _sortKey = makeSortKey( _upcCode, _productName, _brandName );
   return *this;
 }
 /////////////////////// END-TO-DO (17) ////////////////////////////
@@ -274,6 +256,53 @@ GroceryItem & GroceryItem::price( double newPrice ) &
 
 
 
+/*******************************************************************************
+**  Memory Footprint
+*******************************************************************************/
+
+// MemoryUsage::operator+=(...)
+GroceryItem::MemoryUsage & GroceryItem::MemoryUsage::operator+=( MemoryUsage const & rhs ) noexcept
+{
+  inlineBytes   += rhs.inlineBytes;
+  heapBytes     += rhs.heapBytes;
+  payloadBytes  += rhs.payloadBytes;
+  strings       += rhs.strings;
+  inlineStrings += rhs.inlineStrings;
+  return *this;
+}
+
+
+
+// memoryUsage() const
+GroceryItem::MemoryUsage GroceryItem::memoryUsage() const noexcept
+{
+  // The standard doesn't say whether a string's characters are inside the string object, but every implementation's small string
+  // optimization keeps short strings there, so a data() pointing into the object itself means no heap buffer.  std::less gives a
+  // total order even over pointers into unrelated objects.
+  MemoryUsage usage;
+  usage.inlineBytes = sizeof( GroceryItem );
+
+  for( auto field : { &_upcCode, &_brandName, &_productName } )
+  {
+    auto object = reinterpret_cast<char const *>( field );
+    bool inside = !std::less<>{}( field->data(), object ) && std::less<>{}( field->data(), object + sizeof( std::string ) );
+
+    ++usage.strings;
+    usage.payloadBytes += field->size();
+    if( inside )   ++usage.inlineStrings;
+    else           usage.heapBytes += field->capacity() + 1;
+  }
+
+  return usage;
+}
+
+
+
+
+
+
+
+
 /*******************************************************************************
 **  Relational Operators
 *******************************************************************************/
@@ -307,6 +336,12 @@ std::weak_ordering GroceryItem::operator<=>( const GroceryItem & rhs ) const noe
   // Grocery items are equal if all attributes are equal (or within Epsilon for floating point numbers, like price). Grocery items are ordered
   // (sorted) by UPC code, product name, brand name, then price.
 
+  // Differing prefixes settle the order.  Equal ones (or a missing one) say nothing, so fall through to the full comparison.
+  if( _sortKey && rhs._sortKey )
+  {
+    if( auto cmpPrefix = *_sortKey <=> *rhs._sortKey;  cmpPrefix != 0 )   return cmpPrefix;
+  }
+
   ///////////////////////// TO-DO (19) //////////////////////////////
   auto cmpUpc = _upcCode <=> rhs._upcCode;
   if (cmpUpc != 0) return cmpUpc;
@@ -337,6 +372,8 @@ bool GroceryItem::operator==( const GroceryItem & rhs ) const noexcept
   // All attributes must be equal for the two grocery items to be equal to the other.  This can be done in any order, so put the
   // quickest and then the most likely to be different first.
 
+  if( _sortKey && rhs._sortKey && *_sortKey != *rhs._sortKey )   return false;   // differing prefixes mean differing strings
+
   ///////////////////////// TO-DO (20) //////////////////////////////
   if (!floating_point_is_equal(_price, rhs._price))
   {
@@ -359,6 +396,44 @@ bool GroceryItem::operator==( const GroceryItem & rhs ) const noexcept
 
 
 
+/*******************************************************************************
+**  Comparison Prefix
+*******************************************************************************/
+
+// makeSortKey(...)
+std::optional<GroceryItem::SortKey> GroceryItem::makeSortKey( std::string const & upcCode, std::string const & productName, std::string const & brandName ) noexcept
+{
+  // '\0' sorts below every other character, so as a separator it makes a shorter field sort first just as string comparison does.
+  // Zero padding can only ever match a separator, never outrank a character, so prefixes differ only where the strings really do.
+  // std::string compares characters as unsigned char, and so do the big endian integers.
+  SortKey       key{};
+  std::size_t   position = 0;
+  auto append = [&]( std::string const & field )
+  {
+    for( auto c = field.begin();  c != field.end() && position < 16;  ++c, ++position )
+    {
+      key[position / 8] |= std::uint64_t{ static_cast<unsigned char>( *c ) } << ( 8 * ( 7 - position % 8 ) );
+    }
+  };
+
+  for( auto field : { &upcCode, &productName, &brandName } )
+  {
+    if( field->find( '\0' ) != std::string::npos )   return std::nullopt;
+  }
+
+  append( upcCode );      ++position;                               // the separators are the zeros already there
+  append( productName );  ++position;
+  append( brandName );
+  return key;
+}
+
+
+
+
+
+
+
+
 /*******************************************************************************
 **  Insertion and Extraction Operators
 *******************************************************************************/
@@ -424,3 +499,26 @@ std::ostream & operator<<( std::ostream & stream, const GroceryItem & groceryIte
   return stream;
   /////////////////////// END-TO-DO (22) ////////////////////////////
 }
+
+
+
+
+
+
+
+
+/*******************************************************************************
+**  Hash Support
+*******************************************************************************/
+
+// std::hash<GroceryItem>::operator()
+std::size_t std::hash<GroceryItem>::operator()( GroceryItem const & groceryItem ) const noexcept
+{
+  // Combine the string attribute hashes (see boost::hash_combine).  Price intentionally excluded, see class definition.
+  std::hash<std::string> hasher;
+
+  std::size_t seed = hasher( groceryItem.upcCode() );
+  seed ^= hasher( groceryItem.productName() ) + 0x9e3779b97f4a7c15ULL + ( seed << 6 ) + ( seed >> 2 );
+  seed ^= hasher( groceryItem.brandName()   ) + 0x9e3779b97f4a7c15ULL + ( seed << 6 ) + ( seed >> 2 );
+  return seed;
+}
@@ -1,8 +1,14 @@
 #pragma once                                                                  // include guard
 
+#include <array>                                                              // std::array
 #include <compare>                                                            // std::weak_ordering
+#include <cstddef>                                                            // std::size_t
+#include <cstdint>                                                            // std::uint64_t
+#include <functional>                                                         // std::hash
 #include <iostream>
+#include <optional>                                                           // std::optional
 #include <string>
+#include <type_traits>                                                        // std::is_floating_point_v, std::common_type_t
 
 
 
@@ -45,13 +51,70 @@ class GroceryItem
     GroceryItem & price      ( double      newPrice       ) &;                // Error:  GroceryItem{}.price(13.99);           (The default constructed GrocerItem is an r-value, i.e., an unnamed temporary object)
 
 
+    // Memory Footprint
+    struct MemoryUsage                                                        // What a grocery item occupies, in bytes, by where it lives
+    {
+      std::size_t inlineBytes   = 0;                                          // the object itself, wherever it is stored
+      std::size_t heapBytes     = 0;                                          // string buffers allocated outside the object (capacity plus terminator)
+      std::size_t payloadBytes  = 0;                                          // characters actually held by the strings
+      std::size_t strings       = 0;
+      std::size_t inlineStrings = 0;                                          // strings short enough to live inside the object (small string optimization)
+
+      MemoryUsage & operator+=( MemoryUsage const & rhs ) noexcept;           // accumulates over many grocery items
+    };
+
+    MemoryUsage memoryUsage() const noexcept;
+
+
     // Relational Operators
     std::weak_ordering operator<=>( GroceryItem const & rhs ) const noexcept;
     bool               operator== ( GroceryItem const & rhs ) const noexcept;
 
   private:
+    // The leading 16 bytes of upcCode, '\0', productName, '\0', brandName (zero padded) compared as two big endian integers order
+    // grocery items exactly as those strings do, so most comparisons are settled by the prefix alone.  Empty when any of those
+    // strings contains '\0', which would make the separators ambiguous, and after the strings have been moved from.
+    using SortKey = std::array<std::uint64_t, 2>;
+    static std::optional<SortKey> makeSortKey( std::string const & upcCode, std::string const & productName, std::string const & brandName ) noexcept;
+
     std::string _upcCode;                                                     // a 12 or 14-digit international Universal Product Code uniquely identifying this item (Ex: 051600080015, 05017402006207)
     std::string _brandName;                                                   // the product manufacturer's brand name (Ex: Heinz, Boston Market)
     std::string _productName;                                                 // the name of the product (Ex: Heinz Tomato Ketchup - 2 Ct, Boston Market Spaghetti With Meatballs)
     double      _price{ 0.0 };                                                // the cost of the item in US Dollars (Ex:  2.29, 1.19)
+
+    std::optional<SortKey> _sortKey;                                          // cached comparison prefix, recomputed whenever a string attribute changes
+};
+
+
+
+
+// Avoid direct equality comparisons on floating point numbers. Two values are equal if they are "close enough", which is
+// represented by Epsilon.  Usually, this is a pretty small number, but since we are dealing with money (only two, maybe three
+// decimal places) we need to be a bit more tolerant.
+//
+// The two values are "close enough" to be considered equal if the distance between lhs and rhs is less than:
+// o)  EPSILON1, otherwise
+// o)  EPSILON2 percentage of the larger value's magnitude
+//
+// Shared by GroceryItem's relational operators and FixedGroceryCatalog's compile time duplicate check, so both agree on which
+// prices are equal.  std::abs() isn't constexpr until C++23, so magnitudes are taken by hand.
+template< typename T,  typename U >   requires std::is_floating_point_v<std::common_type_t<U, T> >
+constexpr bool floating_point_is_equal( T const lhs,  U const rhs,  long double const EPSILON1 = /*1e-12L*/ 1e-4L,  long double const EPSILON2 = 1e-8L ) noexcept
+{
+  auto magnitude = []( auto value ) { return value < 0 ? -value : value; };
+
+  auto diff    = magnitude( lhs - rhs );
+  auto largest = magnitude( lhs ) > magnitude( rhs ) ? magnitude( lhs ) : magnitude( rhs );
+  return (diff <= EPSILON1) || (diff <= largest * EPSILON2);
+}
+
+
+
+
+// Hash support, so grocery items can be used in unordered containers and filters.  Only the string attributes participate:  prices
+// compare equal within Epsilon, so hashing the price would give equal grocery items different hash values.
+template<>
+struct std::hash<GroceryItem>
+{
+  std::size_t operator()( GroceryItem const & groceryItem ) const noexcept;
 };
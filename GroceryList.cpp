@@ -1,16 +1,22 @@
-#include <algorithm>                                                        // find(), shift_left(), shift_right(), equal(), swap(), lexicographical_compare()
+#include <algorithm>                                                        // find(), copy(), count(), max(), shift_left(), shift_right(), equal(), swap(), lexicographical_compare()
 #include <cmath>                                                            // min()
 #include <compare>                                                          // weak_ordering
 #include <cstddef>                                                          // size_t
 #include <format>                                                           // format()
+#include <functional>                                                       // equal_to, hash, less, reference_wrapper
 #include <initializer_list>                                                 // initializer_list
 #include <iomanip>                                                          // setw()
 #include <iostream>                                                         // istream, istream
 #include <iterator>                                                         // distance(), next()
+#include <list>                                                             // list
 #include <source_location>                                                  // source_location
 #include <stdexcept>                                                        // logic_error
 #include <string>                                                           // string
 #include <string_view>                                                      // string_view
+#include <unordered_map>                                                    // unordered_map
+#include <unordered_set>                                                    // unordered_set
+#include <utility>                                                          // forward(), move()
+#include <vector>                                                           // vector
 #include <version>                                                          // defines feature-test macros, __cpp_lib_stacktrace
 
 #if defined( __cpp_lib_stacktrace )                                         // Clang 19 does not yet support std::stacktrace.
@@ -18,6 +24,7 @@
 #endif
 
 
+#include "BloomFilter.hpp"
 #include "GroceryItem.hpp"
 #include "GroceryList.hpp"
 
@@ -47,6 +54,30 @@ GroceryList::GroceryList( const std::initializer_list<GroceryItem> & initList )
 
 
 
+// Copy Constructor
+GroceryList::GroceryList( GroceryList const & other )
+  : _gList_array           ( other._gList_array            ),
+    _gList_vector          ( other._gList_vector           ),
+    _gList_dll             ( other._gList_dll              ),
+    _gList_sll             ( other._gList_sll              ),
+    _gList_array_size      ( other._gList_array_size       ),
+    _duplicateFilter       ( other._duplicateFilter        ),
+    _duplicateFilterRemovals( other._duplicateFilterRemovals ),
+    _duplicateFilterStats  ( other._duplicateFilterStats   ),
+    _indexes               ( buildIndexes( _gList_dll )    )               // index this list's nodes, not other's
+{}
+
+
+
+// Copy Assignment Operator
+GroceryList & GroceryList::operator=( GroceryList const & rhs )
+{
+  if( this != &rhs )   *this = GroceryList( rhs );                          // copy then move for the strong guarantee
+  return *this;
+}
+
+
+
 // Exception Abstract Class Conversion Constructor
 GroceryList::GroceryList_Ex::GroceryList_Ex( const std::string_view message, const std::source_location location )
   : std::logic_error( std::format( "{}\n detected in function \"{}\"\n at line {}\n in file \"{}\"\n\n********* Begin Stack Trace *********\n{}\n********* End Stack Trace *********\n",
@@ -97,6 +128,127 @@ return _gList_vector.size();
 
 
 
+// duplicateFilterStats() const
+GroceryList::DuplicateFilterStats GroceryList::duplicateFilterStats() const
+{
+  return _duplicateFilterStats;
+}
+
+
+
+// duplicateFilterFalsePositiveRate() const
+double GroceryList::duplicateFilterFalsePositiveRate() const
+{
+  return _duplicateFilter.falsePositiveRate();
+}
+
+
+
+// ContainerUsage::totalBytes() const
+std::size_t GroceryList::ContainerUsage::totalBytes() const noexcept
+{
+  return inlineBytes + unusedBytes + nodeOverheadBytes + stringHeapBytes;
+}
+
+
+
+// ContainerUsage::ssoHitRate() const
+double GroceryList::ContainerUsage::ssoHitRate() const noexcept
+{
+  return strings > 0 ? static_cast<double>( inlineStrings ) / static_cast<double>( strings ) : 0.0;
+}
+
+
+
+// MemoryUsage::totalBytes() const
+std::size_t GroceryList::MemoryUsage::totalBytes() const noexcept
+{
+  // The array is a data member, so its slots are part of sizeof( GroceryList ) already.  Only its strings' heap buffers lie outside.
+  return array.stringHeapBytes + vector.totalBytes() + dll.totalBytes() + sll.totalBytes() + duplicateFilterBytes + indexBytes;
+}
+
+
+
+// memoryUsage() const
+GroceryList::MemoryUsage GroceryList::memoryUsage( std::size_t sampleSize ) const
+{
+  // No container is checked for consistency here, so memory can be inspected even when the grocery list is in a bad state
+  auto const size = _gList_vector.size();
+
+  auto fill = []( ContainerUsage & usage, GroceryItem::MemoryUsage const & strings, std::size_t elements, std::size_t slots, std::size_t linkBytes )
+  {
+    usage.elements           = elements;
+    usage.inlineBytes        = elements * sizeof( GroceryItem );
+    usage.unusedBytes        = ( slots - elements ) * sizeof( GroceryItem );
+    usage.nodeOverheadBytes  = elements * linkBytes;
+    usage.stringHeapBytes    = strings.heapBytes;
+    usage.stringPayloadBytes = strings.payloadBytes;
+    usage.strings            = strings.strings;
+    usage.inlineStrings      = strings.inlineStrings;
+  };
+
+  // A std::list node carries two links ahead of its grocery item, a std::forward_list node one
+  constexpr std::size_t DLL_LINKS = 2 * sizeof( void * );
+  constexpr std::size_t SLL_LINKS = 1 * sizeof( void * );
+
+  MemoryUsage usage;
+  if( sampleSize < size )
+  {
+    // Visit evenly spaced grocery items in the vector and scale up.  Every container holds copies of the same grocery items, so one
+    // sample stands in for all four, and the linked lists needn't be walked at all.
+    auto const samples = std::max<std::size_t>( sampleSize, 1 );
+
+    GroceryItem::MemoryUsage sample;
+    for( std::size_t i = 0; i < samples; ++i )   sample += _gList_vector[i * size / samples].memoryUsage();
+
+    auto scale = [&]( std::size_t value ) { return value * size / samples; };
+    GroceryItem::MemoryUsage strings{ scale( sample.inlineBytes ), scale( sample.heapBytes ),     scale( sample.payloadBytes ),
+                                      scale( sample.strings ),     scale( sample.inlineStrings ) };
+
+    fill( usage.array,  strings, _gList_array_size, _gList_array.size(),      0         );
+    fill( usage.vector, strings, size,              _gList_vector.capacity(), 0         );
+    fill( usage.dll,    strings, size,              size,                     DLL_LINKS );
+    fill( usage.sll,    strings, size,              size,                     SLL_LINKS );
+    usage.array.estimated = usage.vector.estimated = usage.dll.estimated = usage.sll.estimated = true;
+  }
+  else
+  {
+    auto measure = []( auto first, auto last, std::size_t & count )
+    {
+      GroceryItem::MemoryUsage strings;
+      for( count = 0; first != last; ++first, ++count )   strings += first->memoryUsage();
+      return strings;
+    };
+
+    std::size_t count   = 0;
+    auto        strings = measure( _gList_array.begin(), _gList_array.begin() + _gList_array_size, count );
+    fill( usage.array, strings, count, _gList_array.size(), 0 );
+
+    strings = measure( _gList_vector.begin(), _gList_vector.end(), count );
+    fill( usage.vector, strings, count, _gList_vector.capacity(), 0 );
+
+    strings = measure( _gList_dll.begin(), _gList_dll.end(), count );
+    fill( usage.dll, strings, count, count, DLL_LINKS );
+
+    strings = measure( _gList_sll.begin(), _gList_sll.end(), count );
+    fill( usage.sll, strings, count, count, SLL_LINKS );
+  }
+
+  // Tree and hash table nodes are allocated one per entry:  a red-black tree node carries three links and a color ahead of its
+  // value, a hash table node a link and, commonly, the cached hash.  Every grocery item appears in the price index and again in its
+  // brand's group.
+  constexpr std::size_t TREE_NODE = 4 * sizeof( void * ) + sizeof( DllPosition );
+  constexpr std::size_t HASH_NODE = 2 * sizeof( void * ) + sizeof( std::pair<std::string const, BrandGroup> );
+
+  usage.duplicateFilterBytes = _duplicateFilter.heapBytes();
+  usage.indexBytes           = 2 * _indexes.byPrice.size()        * TREE_NODE
+                             +     _indexes.byBrand.bucket_count() * sizeof( void * )
+                             +     _indexes.byBrand.size()         * HASH_NODE;
+  return usage;
+}
+
+
+
 
 
 
@@ -128,33 +280,135 @@ return index; // if not found, index == size()
 
 
 
+// cheapest() const
+std::vector<GroceryItem> GroceryList::cheapest( std::size_t count ) const
+{
+  std::vector<GroceryItem> result;
+  result.reserve( std::min( count, _indexes.byPrice.size() ) );
+  for( auto current = _indexes.byPrice.begin(); current != _indexes.byPrice.end() && result.size() < count; ++current )   result.push_back( **current );
+  return result;
+}
 
 
 
+// mostExpensive() const
+std::vector<GroceryItem> GroceryList::mostExpensive( std::size_t count ) const
+{
+  std::vector<GroceryItem> result;
+  result.reserve( std::min( count, _indexes.byPrice.size() ) );
+  for( auto current = _indexes.byPrice.rbegin(); current != _indexes.byPrice.rend() && result.size() < count; ++current )   result.push_back( **current );
+  return result;
+}
 
 
 
+// brands() const
+std::vector<std::string> GroceryList::brands() const
+{
+  std::vector<std::string> result;
+  result.reserve( _indexes.byBrand.size() );
+  for( auto && [brandName, group] : _indexes.byBrand )   result.push_back( brandName );
+  return result;
+}
 
 
 
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-// Modifiers
-//
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// brandSummary() const
+GroceryList::BrandSummary GroceryList::brandSummary( std::string const & brandName ) const
+{
+  auto brand = _indexes.byBrand.find( brandName );
+  if( brand == _indexes.byBrand.end() )   return {};
 
-// insert( position )
-void GroceryList::insert( const GroceryItem & groceryItem, Position position )
+  auto & group = brand->second;
+  return { group.byPrice.size(), group.totalPrice, ( *group.byPrice.begin() )->price(), ( *group.byPrice.rbegin() )->price() };
+}
+
+
+
+// brandItems() const
+std::vector<GroceryItem> GroceryList::brandItems( std::string const & brandName ) const
 {
-  // Convert the TOP and BOTTOM enumerations to an offset and delegate the work
-  if     ( position == Position::TOP    )  insert( groceryItem, 0      );
-  else if( position == Position::BOTTOM )  insert( groceryItem, size() );
-  else                                     throw std::logic_error( "Unexpected insertion position" );         // Programmer error.  Should never hit this!
+  std::vector<GroceryItem> result;
+
+  auto brand = _indexes.byBrand.find( brandName );
+  if( brand == _indexes.byBrand.end() )   return result;
+
+  result.reserve( brand->second.byPrice.size() );
+  for( auto position : brand->second.byPrice )   result.push_back( *position );
+  return result;
 }
 
 
 
-// insert( offset )
-void GroceryList::insert( const GroceryItem & groceryItem, std::size_t offsetFromTop )        // insert provided grocery item at offsetFromTop, which places it before the current grocery item at offsetFromTop
+// operator[]() const
+GroceryItem const & GroceryList::operator[]( std::size_t offsetFromTop ) const
+{
+  return _gList_vector[offsetFromTop];
+}
+
+
+
+// at() const
+GroceryItem const & GroceryList::at( std::size_t offsetFromTop ) const
+{
+  if( offsetFromTop >= _gList_vector.size() )   throw InvalidOffset_Ex( std::format( "Access position beyond end of current list size\n  position:     {:>2}\n  current size: {:>2}", offsetFromTop, _gList_vector.size() ) );
+  return _gList_vector[offsetFromTop];
+}
+
+
+
+// begin() const
+GroceryList::const_iterator GroceryList::begin() const noexcept
+{
+  return _gList_vector.cbegin();
+}
+
+
+
+// end() const
+GroceryList::const_iterator GroceryList::end() const noexcept
+{
+  return _gList_vector.cend();
+}
+
+
+
+// cbegin() const
+GroceryList::const_iterator GroceryList::cbegin() const noexcept
+{
+  return _gList_vector.cbegin();
+}
+
+
+
+// cend() const
+GroceryList::const_iterator GroceryList::cend() const noexcept
+{
+  return _gList_vector.cend();
+}
+
+
+
+
+
+
+
+
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Modifiers
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// insertItem( offset )
+//
+// The one implementation behind every insert() and emplace() overload.  The grocery item is copied into the first three
+// containers and forwarded into the last, so an r-value grocery item is moved rather than copied there.
+template<typename Item>
+void GroceryList::insertItem( Item && groceryItem, std::size_t offsetFromTop )                // insert provided grocery item at offsetFromTop, which places it before the current grocery item at offsetFromTop
 {
   // Validate offset parameter before attempting the insertion.  std::size_t is an unsigned type, so no need to check for negative
   // offsets, and an offset equal to the size of the list says to insert at the end (bottom) of the list.  Anything greater than the
@@ -163,9 +417,24 @@ void GroceryList::insert( const GroceryItem & groceryItem, std::size_t offsetFro
 
 
   /**********  Prevent duplicate entries  ***********************/
-  ///////////////////////// TO-DO (3) //////////////////////////////
-  if( find( groceryItem ) != size() ) return;
-  /////////////////////// END-TO-DO (3) ////////////////////////////
+  // Most inserted grocery items are new, so consult the duplicate filter first.  A definite miss skips the linear duplicate scan
+  // entirely; only possible hits pay for find().  The grocery item is added to the filter before any container is touched so a
+  // failed insertion can leave behind, at worst, a false positive and never a false negative.
+  auto identity = std::hash<GroceryItem>{}( groceryItem );
+  if( _duplicateFilter.mayContain( identity ) )
+  {
+    ///////////////////////// TO-DO (3) //////////////////////////////
+    if( find( groceryItem ) != size() ) { ++_duplicateFilterStats.hits;  return; }
+    /////////////////////// END-TO-DO (3) ////////////////////////////
+    ++_duplicateFilterStats.falsePositives;
+  }
+  else
+  {
+    ++_duplicateFilterStats.definiteMisses;
+  }
+
+  if( _duplicateFilter.size() >= _duplicateFilter.capacity() )   rebuildDuplicateFilter( _duplicateFilter.falsePositiveRate() );   // keep the false positive rate on target as the list grows
+  _duplicateFilter.insert( identity );
 
 
   // Inserting into the grocery list means you insert the grocery item into each of the containers (array, vector, list, and
@@ -207,8 +476,9 @@ void GroceryList::insert( const GroceryItem & groceryItem, std::size_t offsetFro
 
   { /**********  Part 3 - Insert into doubly linked list  **********/
     ///////////////////////// TO-DO (6) //////////////////////////////
-    _gList_dll.insert( std::next( _gList_dll.begin(), offsetFromTop ), groceryItem );
+    auto position = _gList_dll.insert( std::next( _gList_dll.begin(), offsetFromTop ), groceryItem );
     /////////////////////// END-TO-DO (6) ////////////////////////////
+    _indexes.add( position );
   } // Part 3 - Insert into doubly linked list
 
 
@@ -217,14 +487,68 @@ void GroceryList::insert( const GroceryItem & groceryItem, std::size_t offsetFro
   { /**********  Part 4 - Insert into singly linked list  **********/
     ///////////////////////// TO-DO (7) //////////////////////////////
 auto iteratorPos = std::next(_gList_sll.before_begin(), offsetFromTop);
-_gList_sll.insert_after(iteratorPos, groceryItem);
+_gList_sll.insert_after(iteratorPos, std::forward<Item>( groceryItem ));   // last use, so an r-value grocery item may now be moved from
     /////////////////////// END-TO-DO (7) ////////////////////////////
   } // Part 4 - Insert into singly linked list
 
 
   // Verify the internal grocery list state is still consistent amongst the four containers
   if( !containersAreConsistant() )   throw InvalidInternalState_Ex( "Container consistency error" );
-} // insert( const GroceryItem & groceryItem, std::size_t offsetFromTop )
+} // insertItem( Item && groceryItem, std::size_t offsetFromTop )
+
+
+
+// insert( position )
+void GroceryList::insert( const GroceryItem & groceryItem, Position position )
+{
+  // Convert the TOP and BOTTOM enumerations to an offset and delegate the work
+  if     ( position == Position::TOP    )  insert( groceryItem, 0      );
+  else if( position == Position::BOTTOM )  insert( groceryItem, size() );
+  else                                     throw std::logic_error( "Unexpected insertion position" );         // Programmer error.  Should never hit this!
+}
+
+
+
+// insert( position ) for r-values
+void GroceryList::insert( GroceryItem && groceryItem, Position position )
+{
+  if     ( position == Position::TOP    )  insert( std::move( groceryItem ), 0      );
+  else if( position == Position::BOTTOM )  insert( std::move( groceryItem ), size() );
+  else                                     throw std::logic_error( "Unexpected insertion position" );         // Programmer error.  Should never hit this!
+}
+
+
+
+// insert( offset )
+void GroceryList::insert( const GroceryItem & groceryItem, std::size_t offsetFromTop )
+{
+  insertItem( groceryItem, offsetFromTop );
+}
+
+
+
+// insert( offset ) for r-values
+void GroceryList::insert( GroceryItem && groceryItem, std::size_t offsetFromTop )
+{
+  insertItem( std::move( groceryItem ), offsetFromTop );
+}
+
+
+
+// emplace( position )
+void GroceryList::emplace( Position position, std::string productName, std::string brandName, std::string upcCode, double price )
+{
+  // The by-value strings are moved into the new grocery item, and the new grocery item is moved into the list
+  insert( GroceryItem( std::move( productName ), std::move( brandName ), std::move( upcCode ), price ), position );
+}
+
+
+
+// emplace( offset )
+void GroceryList::emplace( std::size_t offsetFromTop, std::string productName, std::string brandName, std::string upcCode, double price )
+{
+  insert( GroceryItem( std::move( productName ), std::move( brandName ), std::move( upcCode ), price ), offsetFromTop );
+}
 
 
 
@@ -274,7 +598,9 @@ void GroceryList::remove( std::size_t offsetFromTop )
 
   { /**********  Part 3 - Remove from doubly linked list  **********/
     ///////////////////////// TO-DO (10) //////////////////////////////
-    _gList_dll.erase( std::next( _gList_dll.begin(), offsetFromTop ) );
+    auto position = std::next( _gList_dll.begin(), offsetFromTop );
+    _indexes.erase( position );
+    _gList_dll.erase( position );
     /////////////////////// END-TO-DO (10) ////////////////////////////
   } // Part 3 - Remove from doubly linked list
 
@@ -290,6 +616,10 @@ void GroceryList::remove( std::size_t offsetFromTop )
   } // Part 4 - Remove from singly linked list
 
 
+  // Bloom filters can't forget, so removed grocery items linger as false positives.  Once removals dominate, start over.
+  if( ++_duplicateFilterRemovals > _duplicateFilter.size() / 2 )   rebuildDuplicateFilter( _duplicateFilter.falsePositiveRate() );
+
+
   // Verify the internal grocery list state is still consistent amongst the four containers
   if( !containersAreConsistant() )   throw InvalidInternalState_Ex( "Container consistency error" );
 } // remove( std::size_t offsetFromTop )
@@ -311,6 +641,23 @@ void GroceryList::moveToTop( const GroceryItem & groceryItem )
 
 
 
+// removeAll( initializer_list )
+std::size_t GroceryList::removeAll( std::initializer_list<GroceryItem> const & groceryItems )
+{
+  return removeAll<std::initializer_list<GroceryItem>>( groceryItems );
+}
+
+
+
+// updatePrice()
+std::size_t GroceryList::updatePrice( std::string const & upcCode, double newPrice )
+{
+  std::unordered_set<std::string_view> matchedUpcs;
+  return repriceByUpc( { { upcCode, newPrice } }, matchedUpcs );
+}
+
+
+
 // operator+=( initializer_list )
 GroceryList & GroceryList::operator+=( const std::initializer_list<GroceryItem> & rhs )
 {
@@ -345,6 +692,14 @@ GroceryList & GroceryList::operator+=( const GroceryList & rhs )
 
 
 
+// duplicateFilterFalsePositiveRate()
+void GroceryList::duplicateFilterFalsePositiveRate( double rate )
+{
+  rebuildDuplicateFilter( rate );
+}
+
+
+
 
 
 
@@ -457,6 +812,238 @@ std::size_t GroceryList::gList_sll_size() const
 
 
 
+// replaceContents()
+void GroceryList::replaceContents( std::vector<GroceryItem> groceryItems )
+{
+  // The caller guarantees the grocery items are distinct, so no per-item duplicate checks are made.  Each container is built off to
+  // the side and then swapped into place, so if anything throws this grocery list is left unchanged.
+  if( groceryItems.size() > _gList_array.size() )   throw CapacityExceeded_Ex( std::format( "Capacity Exceeded, array capacity: {}, list size: {}", _gList_array.size(), groceryItems.size() ) );
+
+  decltype( _gList_array ) array;
+  std::copy( groceryItems.begin(), groceryItems.end(), array.begin() );
+
+  decltype( _gList_dll ) dll( groceryItems.begin(), groceryItems.end() );
+  decltype( _gList_sll ) sll( groceryItems.begin(), groceryItems.end() );
+
+  BloomFilter filter( std::max<std::size_t>( 64, 2 * groceryItems.size() ), _duplicateFilter.falsePositiveRate() );
+  for( auto && groceryItem : groceryItems )   filter.insert( std::hash<GroceryItem>{}( groceryItem ) );
+
+  auto indexes = buildIndexes( dll );                                       // swapping lists keeps their nodes, so these stay valid
+
+  // Nothing below throws
+  _gList_array_size = groceryItems.size();
+  _gList_array .swap( array );
+  _gList_dll   .swap( dll   );
+  _gList_sll   .swap( sll   );
+  _gList_vector.swap( groceryItems );                                       // last use, the grocery items move rather than copy into the vector
+  std::swap( _indexes, indexes );
+
+  _duplicateFilter         = std::move( filter );
+  _duplicateFilterRemovals = 0;
+  ++_duplicateFilterStats.rebuilds;
+
+  // Verify the internal grocery list state is still consistent amongst the four containers
+  if( !containersAreConsistant() )   throw InvalidInternalState_Ex( "Container consistency error" );
+}
+
+
+
+// buildIndexes()
+GroceryList::Indexes GroceryList::buildIndexes( std::list<GroceryItem> const & dll )
+{
+  Indexes indexes;
+  for( auto position = dll.begin(); position != dll.end(); ++position )   indexes.add( position );
+  return indexes;
+}
+
+
+
+// removeMarked()
+std::size_t GroceryList::removeMarked( std::vector<bool> const & doomed )
+{
+  // Each container is compacted (or unlinked) in a single linear pass, replacing one O(N) find() and O(N) shift or walk per removed
+  // grocery item, and the containers are validated once at the end rather than after every removal.
+  auto removed = static_cast<std::size_t>( std::count( doomed.begin(), doomed.end(), true ) );
+  if( removed == 0 )   return 0;
+
+
+  { /**********  Part 1 - Remove from array  ***********************/
+    std::size_t kept = 0;
+    for( std::size_t i = 0; i < _gList_array_size; ++i )
+    {
+      if( doomed[i] )   continue;
+      if( kept != i )   _gList_array[kept] = std::move( _gList_array[i] );
+      ++kept;
+    }
+    for( auto i = kept; i < _gList_array_size; ++i )   _gList_array[i] = GroceryItem{};   // default the leftovers
+    _gList_array_size = kept;
+  } // Part 1 - Remove from array
+
+
+  { /**********  Part 2 - Remove from vector  **********************/
+    std::size_t kept = 0;
+    for( std::size_t i = 0; i < _gList_vector.size(); ++i )
+    {
+      if( doomed[i] )   continue;
+      if( kept != i )   _gList_vector[kept] = std::move( _gList_vector[i] );
+      ++kept;
+    }
+    _gList_vector.erase( std::next( _gList_vector.begin(), kept ), _gList_vector.end() );
+  } // Part 2 - Remove from vector
+
+
+  { /**********  Part 3 - Remove from doubly linked list  **********/
+    std::size_t i = 0;
+    for( auto current = _gList_dll.begin(); current != _gList_dll.end(); ++i )
+    {
+      if( doomed[i] ) { _indexes.erase( current );  current = _gList_dll.erase( current ); }
+      else              ++current;
+    }
+  } // Part 3 - Remove from doubly linked list
+
+
+  { /**********  Part 4 - Remove from singly linked list  **********/
+    std::size_t i = 0;
+    for( auto previous = _gList_sll.before_begin(); std::next( previous ) != _gList_sll.end(); ++i )
+    {
+      if( doomed[i] )   _gList_sll.erase_after( previous );
+      else              ++previous;
+    }
+  } // Part 4 - Remove from singly linked list
+
+
+  _duplicateFilterRemovals += removed;
+  if( _duplicateFilterRemovals > _duplicateFilter.size() / 2 )   rebuildDuplicateFilter( _duplicateFilter.falsePositiveRate() );
+
+  // Verify the internal grocery list state is still consistent amongst the four containers
+  if( !containersAreConsistant() )   throw InvalidInternalState_Ex( "Container consistency error" );
+  return removed;
+}
+
+
+
+// repriceByUpc()
+std::size_t GroceryList::repriceByUpc( std::unordered_map<std::string, double> const & prices, std::unordered_set<std::string_view> & matchedUpcs )
+{
+  // Walk all four containers in unison.  They hold the same grocery items in the same order, so the price looked up for the vector's
+  // grocery item applies to the other three at the same position.  No grocery item is removed, inserted, or shifted.
+  std::vector<bool> repriced( _gList_vector.size(), false );
+  std::size_t       count = 0;
+
+  auto current_array_position   = _gList_array .begin();
+  auto current_dll_position     = _gList_dll   .begin();
+  auto current_sll_position     = _gList_sll   .begin();
+
+  for( std::size_t i = 0; i < _gList_vector.size(); ++i, ++current_array_position, ++current_dll_position, ++current_sll_position )
+  {
+    auto match = prices.find( _gList_vector[i].upcCode() );
+    if( match == prices.end() )   continue;
+
+    _indexes.erase( current_dll_position );                                 // re-key the indexes around the price change
+
+    _gList_vector[i]        .price( match->second );
+    current_array_position ->price( match->second );
+    current_dll_position   ->price( match->second );
+    current_sll_position   ->price( match->second );
+
+    _indexes.add( current_dll_position );
+
+    matchedUpcs.insert( match->first );
+    repriced[i] = true;
+    ++count;
+  }
+
+  // Grocery items that differed only by price may now be equal.  Only repriced grocery items can collide (all grocery items sharing
+  // a UPC were repriced together), so keep the topmost of each and drop the rest to preserve the no duplicates guarantee.
+  GroceryItemRefSet seen;
+  std::vector<bool> doomed( _gList_vector.size(), false );
+  bool              collisions = false;
+  for( std::size_t i = 0; i < _gList_vector.size(); ++i )
+  {
+    if( repriced[i] && !seen.insert( _gList_vector[i] ).second )   doomed[i] = collisions = true;
+  }
+  if( collisions )   removeMarked( doomed );
+
+  // Verify the internal grocery list state is still consistent amongst the four containers
+  if( !containersAreConsistant() )   throw InvalidInternalState_Ex( "Container consistency error" );
+  return count;
+}
+
+
+
+// rebuildDuplicateFilter()
+void GroceryList::rebuildDuplicateFilter( double falsePositiveRate )
+{
+  // Leave room to grow so steady insertion doesn't trigger a rebuild on every call
+  BloomFilter filter( std::max<std::size_t>( 64, 2 * _gList_vector.size() ), falsePositiveRate );
+  for( auto && groceryItem : _gList_vector )   filter.insert( std::hash<GroceryItem>{}( groceryItem ) );
+
+  _duplicateFilter         = std::move( filter );
+  _duplicateFilterRemovals = 0;
+  ++_duplicateFilterStats.rebuilds;
+}
+
+
+
+
+
+
+
+
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Secondary Indexes
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// ByPrice::operator()
+bool GroceryList::ByPrice::operator()( DllPosition lhs, DllPosition rhs ) const noexcept
+{
+  // An ordering needs exact comparisons (an Epsilon tolerance isn't transitive), so prices are compared directly here
+  if( lhs->price() < rhs->price() )   return true;
+  if( rhs->price() < lhs->price() )   return false;
+  return std::less<GroceryItem const *>{}( &*lhs, &*rhs );
+}
+
+
+
+// Indexes::add()
+void GroceryList::Indexes::add( DllPosition position )
+{
+  auto [brand, created] = byBrand.try_emplace( position->brandName() );
+  try
+  {
+    brand->second.byPrice.insert( position );
+    byPrice.insert( position );
+  }
+  catch( ... )
+  {
+    brand->second.byPrice.erase( position );
+    if( created )   byBrand.erase( brand );
+    throw;
+  }
+  brand->second.totalPrice += position->price();
+}
+
+
+
+// Indexes::erase()
+void GroceryList::Indexes::erase( DllPosition position ) noexcept
+{
+  byPrice.erase( position );
+
+  auto brand = byBrand.find( position->brandName() );
+  if( brand == byBrand.end() || brand->second.byPrice.erase( position ) == 0 )   return;
+
+  // Dropping emptied groups also discards the rounding error the running total has accumulated
+  if( brand->second.byPrice.empty() )   byBrand.erase( brand );
+  else                                  brand->second.totalPrice -= position->price();
+}
+
+
 
 
 
@@ -501,3 +1088,65 @@ std::istream & operator>>( std::istream & stream, GroceryList & groceryList )
 
   return stream;
 }
+
+
+
+// setUnion()
+GroceryList setUnion( GroceryList const & lhs, GroceryList const & rhs )
+{
+  GroceryList::GroceryItemRefSet onLeft( lhs.begin(), lhs.end() );
+
+  std::vector<GroceryItem> result( lhs.begin(), lhs.end() );
+  for( auto && groceryItem : rhs )   if( !onLeft.contains( groceryItem ) )   result.push_back( groceryItem );
+
+  GroceryList groceryList;
+  groceryList.replaceContents( std::move( result ) );
+  return groceryList;
+}
+
+
+
+// setIntersection()
+GroceryList setIntersection( GroceryList const & lhs, GroceryList const & rhs )
+{
+  GroceryList::GroceryItemRefSet onRight( rhs.begin(), rhs.end() );
+
+  std::vector<GroceryItem> result;
+  for( auto && groceryItem : lhs )   if( onRight.contains( groceryItem ) )   result.push_back( groceryItem );
+
+  GroceryList groceryList;
+  groceryList.replaceContents( std::move( result ) );
+  return groceryList;
+}
+
+
+
+// setDifference()
+GroceryList setDifference( GroceryList const & lhs, GroceryList const & rhs )
+{
+  GroceryList::GroceryItemRefSet onRight( rhs.begin(), rhs.end() );
+
+  std::vector<GroceryItem> result;
+  for( auto && groceryItem : lhs )   if( !onRight.contains( groceryItem ) )   result.push_back( groceryItem );
+
+  GroceryList groceryList;
+  groceryList.replaceContents( std::move( result ) );
+  return groceryList;
+}
+
+
+
+// setSymmetricDifference()
+GroceryList setSymmetricDifference( GroceryList const & lhs, GroceryList const & rhs )
+{
+  GroceryList::GroceryItemRefSet onLeft ( lhs.begin(), lhs.end() );
+  GroceryList::GroceryItemRefSet onRight( rhs.begin(), rhs.end() );
+
+  std::vector<GroceryItem> result;
+  for( auto && groceryItem : lhs )   if( !onRight.contains( groceryItem ) )   result.push_back( groceryItem );
+  for( auto && groceryItem : rhs )   if( !onLeft .contains( groceryItem ) )   result.push_back( groceryItem );
+
+  GroceryList groceryList;
+  groceryList.replaceContents( std::move( result ) );
+  return groceryList;
+}
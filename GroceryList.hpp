@@ -1,17 +1,28 @@
 #pragma once                                                                                      // include guard
 
+#include <algorithm>                                                                              // sort(), stable_sort()
 #include <array>
 #include <compare>                                                                                // weak_ordering
 #include <cstddef>                                                                                // size_t
 #include <forward_list>
+#include <functional>                                                                             // equal_to, hash, reference_wrapper, invoke()
 #include <initializer_list>                                                                       // initializer_list
 #include <iostream>                                                                               // istream, istream
+#include <limits>                                                                                 // numeric_limits
 #include <list>
+#include <ranges>                                                                                 // input_range, range_reference_t, less
+#include <set>
 #include <source_location>                                                                        // source_location
 #include <stdexcept>                                                                              // domain_error, length_error, logic_error
+#include <string>                                                                                 // string
 #include <string_view>                                                                            // string_view
+#include <type_traits>                                                                            // is_lvalue_reference_v, is_invocable_r_v
+#include <utility>                                                                                // get(), move()
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
+#include "BloomFilter.hpp"
 #include "GroceryItem.hpp"
 
 
@@ -21,10 +32,30 @@ class GroceryList
   friend std::ostream & operator<<( std::ostream & stream, GroceryList const & groceryList );
   friend std::istream & operator>>( std::istream & stream, GroceryList       & groceryList );
 
+  // Set Algebra - results keep the left operand's order, followed (where applicable) by the right operand's in its order.  Each runs
+  // in O(N + M) by hashing one operand, rather than the O(N*M) of a linear duplicate check per grocery item.
+  friend GroceryList setUnion              ( GroceryList const & lhs, GroceryList const & rhs );  // grocery items on either list
+  friend GroceryList setIntersection       ( GroceryList const & lhs, GroceryList const & rhs );  // grocery items on both lists
+  friend GroceryList setDifference         ( GroceryList const & lhs, GroceryList const & rhs );  // grocery items on lhs but not rhs
+  friend GroceryList setSymmetricDifference( GroceryList const & lhs, GroceryList const & rhs );  // grocery items on exactly one list
+
+  // Transactions replay their edits off to the side and install the result through the bulk replacement path
+  friend class GroceryListTransaction;
+
+  // Fixed catalogs rule out duplicates at compile time, so they install their grocery items through the bulk replacement path too
+  template<std::size_t N> friend class FixedGroceryCatalog;
+
   public:
     // Types and Exceptions
     enum class Position {TOP, BOTTOM};
 
+    using value_type     = GroceryItem;                                                           // read-only, random access iteration over the vector backing the list
+    using size_type      = std::size_t;
+    using const_iterator = std::vector<GroceryItem>::const_iterator;
+    using iterator       = const_iterator;                                                        // grocery items can't be modified in place, that would bypass the other containers
+
+    static constexpr std::size_t CAPACITY = 11;                                                   // the most grocery items a list can hold, fixed by the underlying array
+
     struct GroceryList_Ex : std::logic_error                                                      // Abstract class forming the base of all errors detected by GroceryItem
     {                                                                                             // Captures errors that are a consequence of faulty logic within GroceryList
       GroceryList_Ex( const std::string_view message, const std::source_location location = std::source_location::current() );
@@ -34,36 +65,126 @@ class GroceryList
     struct CapacityExceeded_Ex     : GroceryList_Ex { using GroceryList_Ex::GroceryList_Ex; };    // Thrown if more grocery items are inserted than will fit
     struct InvalidOffset_Ex        : GroceryList_Ex { using GroceryList_Ex::GroceryList_Ex; };    // Thrown if inserting beyond current size
 
+    struct DuplicateFilterStats                                                                   // Effectiveness of the duplicate filter consulted by insert()
+    {
+      std::size_t definiteMisses = 0;                                                             // inserts that skipped the duplicate scan entirely
+      std::size_t hits           = 0;                                                             // inserts rejected as duplicates after the scan confirmed the filter
+      std::size_t falsePositives = 0;                                                             // inserts the filter flagged but the scan found no duplicate
+      std::size_t rebuilds       = 0;                                                             // times the filter was rebuilt after growth or heavy removal
+    };
+
+    struct BrandSummary                                                                           // Running aggregates over one brand's grocery items
+    {
+      std::size_t count      = 0;
+      double      totalPrice = 0.0;
+      double      minPrice   = 0.0;                                                               // zero when count is zero
+      double      maxPrice   = 0.0;
+    };
+
+    struct ContainerUsage                                                                         // One container's share of a grocery list's memory, in bytes
+    {
+      std::size_t elements           = 0;
+      std::size_t inlineBytes        = 0;                                                         // grocery item objects holding grocery items
+      std::size_t unusedBytes        = 0;                                                         // slots reserved but holding no grocery item:  the array's tail, the vector's spare capacity
+      std::size_t nodeOverheadBytes  = 0;                                                         // linked list links, excluding whatever the allocator adds per node
+      std::size_t stringHeapBytes    = 0;                                                         // string buffers allocated outside the grocery item objects
+      std::size_t stringPayloadBytes = 0;                                                         // characters actually held
+      std::size_t strings            = 0;
+      std::size_t inlineStrings      = 0;                                                         // strings kept inside their objects by the small string optimization
+      bool        estimated          = false;                                                     // string figures were scaled up from a sample
+
+      std::size_t totalBytes() const noexcept;                                                    // inline, unused, node overhead, and string heap bytes
+      double      ssoHitRate() const noexcept;                                                    // fraction of strings needing no heap buffer, zero when there are no strings
+    };
+
+    struct MemoryUsage                                                                            // A grocery list's memory, container by container
+    {
+      ContainerUsage array;
+      ContainerUsage vector;
+      ContainerUsage dll;
+      ContainerUsage sll;
+      std::size_t    duplicateFilterBytes = 0;                                                    // insert()'s Bloom filter
+      std::size_t    indexBytes           = 0;                                                    // the price and brand indexes, estimated from their entry counts
+
+      std::size_t totalBytes() const noexcept;                                                    // memory outside the GroceryList object, so excludes the array's slots; add sizeof( GroceryList ) for the whole
+    };
+
 
 
     // Constructors, destructor, and assignments
     //
-    // The compiler synthesized copy and move constructors, and copy and move assignment operators work just fine.  But since I also
-    // have user defined constructors, I need to explicitly say the compiler synthesized default constructor is also okay.
+    // The secondary indexes refer to this list's own doubly linked list nodes, so a copy must rebuild them rather than copy them.
+    // Moving a std::list keeps its nodes (and so the indexes) intact, so the compiler synthesized move operations work just fine.
     GroceryList() = default;                                                                      // constructs an empty grocery list
     GroceryList( std::initializer_list<GroceryItem> const & initList );                           // constructs a grocery list from a braced list of grocery items
 
+    GroceryList            ( GroceryList const  & other );
+    GroceryList            ( GroceryList       && other ) = default;
+    GroceryList & operator=( GroceryList const  & rhs   );
+    GroceryList & operator=( GroceryList       && rhs   ) = default;
+   ~GroceryList            (                            ) = default;
+
 
     // Queries
-    std::size_t size() const;                                                                     // returns the number of grocery items in this grocery list
+    std::size_t          size                             () const;                               // returns the number of grocery items in this grocery list
+    DuplicateFilterStats duplicateFilterStats             () const;                               // returns insert()'s duplicate filter counters
+    double               duplicateFilterFalsePositiveRate () const;                               // returns the duplicate filter's target false positive rate
+    MemoryUsage          memoryUsage( std::size_t sampleSize = std::numeric_limits<std::size_t>::max() ) const;   // exact, or estimated in O(sampleSize) from that many grocery items
 
 
     // Accessors
     std::size_t find( const GroceryItem & groceryItem ) const;                                    // returns the grocery item's (zero-based) offset from top, size() if grocery item not found
 
+    GroceryItem const & operator[]( std::size_t offsetFromTop ) const;                            // unchecked, like std::vector
+    GroceryItem const & at        ( std::size_t offsetFromTop ) const;                            // throws InvalidOffset_Ex if offsetFromTop >= size()
+
+    std::vector<GroceryItem> cheapest     ( std::size_t count ) const;                            // the count lowest priced grocery items, lowest first, in O(count)
+    std::vector<GroceryItem> mostExpensive( std::size_t count ) const;                            // the count highest priced grocery items, highest first, in O(count)
+
+    std::vector<std::string> brands       (                               ) const;                // every brand with at least one grocery item, in no particular order
+    BrandSummary             brandSummary ( std::string const & brandName ) const;                // O(1), all zeros for an unknown brand
+    std::vector<GroceryItem> brandItems   ( std::string const & brandName ) const;                // the brand's grocery items, lowest price first, in O(items in brand)
+
+    const_iterator begin () const noexcept;                                                       // iterators, and references from operator[] and at(), are invalidated by any modifier
+    const_iterator end   () const noexcept;
+    const_iterator cbegin() const noexcept;
+    const_iterator cend  () const noexcept;
+
 
     // Modifiers
     void insert   ( GroceryItem const & groceryItem, Position    position = Position::TOP );      // inserts the grocery item at the top (beginning) or bottom (end) of the grocery list
     void insert   ( GroceryItem const & groceryItem, std::size_t offsetFromTop            );      // inserts before the existing grocery item currently at that offset
+    void insert   ( GroceryItem      && groceryItem, Position    position = Position::TOP );      // r-value overloads move the grocery item into the list instead of copying it
+    void insert   ( GroceryItem      && groceryItem, std::size_t offsetFromTop            );
+
+    void emplace  ( Position    position,      std::string productName,   std::string brandName = {}, // constructs the grocery item in place from its attributes
+                    std::string upcCode = {},  double      price = 0.0                             ); // String parameters intentionally passed by value (see GroceryItem)
+    void emplace  ( std::size_t offsetFromTop, std::string productName,   std::string brandName = {},
+                    std::string upcCode = {},  double      price = 0.0                             );
 
     void remove   ( GroceryItem const & groceryItem                                       );      // no change occurs if grocery item not found
     void remove   ( std::size_t         offsetFromTop                                     );      // no change occurs if (zero-based) offsetFromTop >= size()
 
     void moveToTop( GroceryItem const & groceryItem                                       );      // finds then moves grocery item from its current position to the top of the grocery list
 
+    template<typename Predicate>
+    std::size_t removeIf ( Predicate predicate                                     );             // removes every grocery item satisfying the predicate in one pass, returns the number removed
+    template<std::ranges::input_range Range>
+    std::size_t removeAll( Range const & groceryItems                              );             // removes every listed grocery item in one pass, returns the number removed
+    std::size_t removeAll( std::initializer_list<GroceryItem> const & groceryItems );
+
+    std::size_t              updatePrice   ( std::string const & upcCode, double newPrice );      // reprices every grocery item with that UPC in place, returns the number repriced
+    template<std::ranges::input_range Range>
+    std::vector<std::string> applyPriceFeed( Range const & feed                           );      // feed of (UPC, price) pairs applied in one pass, returns the feed's unknown UPCs
+
+    template<typename KeyOrCompare = std::ranges::less>
+    void sortBy( KeyOrCompare keyOrCompare = {}, bool stable = true );                            // reorders by a comparator, or by a key compared with <
+
     GroceryList & operator+=( std::initializer_list<GroceryItem> const & rhs );                   // appends (aka concatenates) a braced list of grocery items to the end of this list
     GroceryList & operator+=( GroceryList                        const & rhs );                   // appends (aka concatenates) the rhs list to the bottom of this list
 
+    void duplicateFilterFalsePositiveRate( double rate );                                         // rebuilds the duplicate filter with a new target false positive rate (0, 0.5]
+
 
     // Relational Operators
     std::weak_ordering operator<=>( GroceryList const & rhs ) const;
@@ -71,16 +192,139 @@ class GroceryList
 
 
   private:
+    // Types
+    using GroceryItemRefSet = std::unordered_set<std::reference_wrapper<GroceryItem const>, std::hash<GroceryItem>, std::equal_to<GroceryItem>>;   // hashed view of grocery items owned elsewhere
+    using DllPosition       = std::list<GroceryItem>::const_iterator;                             // list nodes never move, so their positions make stable index entries
+
+    struct ByPrice                                                                                // orders by price, ties broken by node address so the order is total
+    {
+      bool operator()( DllPosition lhs, DllPosition rhs ) const noexcept;
+    };
+
+    struct BrandGroup                                                                             // one brand's grocery items and running total
+    {
+      std::set<DllPosition, ByPrice> byPrice;                                                     // cheapest and most expensive at either end
+      double                         totalPrice = 0.0;
+    };
+
+    struct Indexes                                                                                // secondary indexes over the doubly linked list, kept current by every modifier
+    {
+      std::set<DllPosition, ByPrice>                  byPrice;
+      std::unordered_map<std::string, BrandGroup>     byBrand;                                    // groups are dropped when their last grocery item leaves
+
+      void add  ( DllPosition position );
+      void erase( DllPosition position ) noexcept;
+    };
+
     // Instance Attributes
-    std::array       <GroceryItem, 11>  _gList_array;                                             // underlying containers holding grocery items
-    std::vector      <GroceryItem    >  _gList_vector;                                            // operations performed on once container must be
-    std::list        <GroceryItem    >  _gList_dll;                                               // replicated across all containers
-    std::forward_list<GroceryItem    >  _gList_sll;
+    std::array       <GroceryItem, CAPACITY>  _gList_array;                                       // underlying containers holding grocery items
+    std::vector      <GroceryItem          >  _gList_vector;                                      // operations performed on once container must be
+    std::list        <GroceryItem          >  _gList_dll;                                         // replicated across all containers
+    std::forward_list<GroceryItem          >  _gList_sll;
+
+    std::size_t                               _gList_array_size = 0;                              // number of valid elements in _gList_array
 
-    std::size_t                         _gList_array_size = 0;                                    // number of valid elements in _gList_array
+    BloomFilter                               _duplicateFilter;                                   // fast reject for insert()'s duplicate scan, may hold removed items
+    std::size_t                               _duplicateFilterRemovals = 0;                       // removals since the filter was last rebuilt
+    DuplicateFilterStats                      _duplicateFilterStats;
+
+    Indexes                                   _indexes;                                           // must follow _gList_dll, the copy constructor builds it from the copied list
 
 
     // Helper member functions
     bool        containersAreConsistant() const;
     std::size_t gList_sll_size         () const;                                                  // std::forward_list doesn't maintain size, so calculate it on demand
+    void        rebuildDuplicateFilter ( double falsePositiveRate );                              // resizes for the current size and forgets removed items
+    static Indexes buildIndexes        ( std::list<GroceryItem> const & dll );                    // indexes every node of the given list
+
+    template<typename Item>
+    void        insertItem             ( Item && groceryItem, std::size_t offsetFromTop );        // implements insert(), copying or moving the grocery item as given
+    void        replaceContents        ( std::vector<GroceryItem> groceryItems );                 // rebuilds every container from distinct grocery items in one pass each, strong guarantee
+    std::size_t removeMarked           ( std::vector<bool> const & doomed );                      // removes the grocery items at the marked offsets from every container in one pass
+    std::size_t repriceByUpc           ( std::unordered_map<std::string, double> const & prices,  // reprices in one pass over the containers, returns the number repriced
+                                         std::unordered_set<std::string_view>    & matchedUpcs );
 };
+
+
+
+
+
+
+
+
+/*******************************************************************************
+**  Template definitions
+*******************************************************************************/
+
+// removeIf()
+template<typename Predicate>
+std::size_t GroceryList::removeIf( Predicate predicate )
+{
+  // Evaluate the predicate exactly once per grocery item, then let every container drop the same offsets
+  std::vector<bool> doomed;
+  doomed.reserve( _gList_vector.size() );
+  for( auto const & groceryItem : _gList_vector )   doomed.push_back( static_cast<bool>( predicate( groceryItem ) ) );
+
+  return removeMarked( doomed );
+}
+
+
+
+// removeAll()
+template<std::ranges::input_range Range>
+std::size_t GroceryList::removeAll( Range const & groceryItems )
+{
+  static_assert( std::is_lvalue_reference_v<std::ranges::range_reference_t<Range const>>,
+                 "removeAll() refers to the listed grocery items rather than copying them, so they must be l-values" );
+
+  // Hash the grocery items to remove once, so each grocery item in this list is checked in O(1) rather than by a linear scan
+  GroceryItemRefSet targets;
+  for( GroceryItem const & groceryItem : groceryItems )   targets.insert( groceryItem );
+
+  return removeIf( [&]( GroceryItem const & groceryItem ) { return targets.contains( groceryItem ); } );
+}
+
+
+
+// applyPriceFeed()
+template<std::ranges::input_range Range>
+std::vector<std::string> GroceryList::applyPriceFeed( Range const & feed )
+{
+  // Collapse the feed into a UPC -> price table (the last price for a UPC wins), remembering the order UPCs were first seen so
+  // unknown UPCs are reported in feed order
+  std::unordered_map<std::string, double> prices;
+  std::vector<std::string>                feedOrder;
+  for( auto const & entry : feed )
+  {
+    auto const & upcCode = std::get<0>( entry );
+    auto const   price   = static_cast<double>( std::get<1>( entry ) );
+    if( prices.insert_or_assign( std::string( upcCode ), price ).second )   feedOrder.emplace_back( upcCode );
+  }
+
+  std::unordered_set<std::string_view> matchedUpcs;
+  repriceByUpc( prices, matchedUpcs );
+
+  std::erase_if( feedOrder, [&]( std::string const & upcCode ) { return matchedUpcs.contains( upcCode ); } );
+  return feedOrder;
+}
+
+
+
+// sortBy()
+template<typename KeyOrCompare>
+void GroceryList::sortBy( KeyOrCompare keyOrCompare, bool stable )
+{
+  // Something callable with two grocery items is a comparator, something callable with one extracts the key to compare
+  auto compare = [&]( GroceryItem const & lhs, GroceryItem const & rhs ) -> bool
+  {
+    if constexpr( std::is_invocable_r_v<bool, KeyOrCompare &, GroceryItem const &, GroceryItem const &> )   return std::invoke( keyOrCompare, lhs, rhs );
+    else                                                                                                   return std::ranges::less{}( std::invoke( keyOrCompare, lhs ), std::invoke( keyOrCompare, rhs ) );
+  };
+
+  // Sort a copy, then rebuild every container from it in one pass each.  Nothing changes until replaceContents() swaps the result
+  // in, so a throwing comparator leaves this list as it was.
+  std::vector<GroceryItem> sorted( _gList_vector );
+  if( stable )   std::stable_sort( sorted.begin(), sorted.end(), compare );
+  else           std::sort       ( sorted.begin(), sorted.end(), compare );
+  replaceContents( std::move( sorted ) );
+}
@@ -0,0 +1,276 @@
+#include <algorithm>                                                        // clamp(), min(), max()
+#include <atomic>                                                           // atomic
+#include <cctype>                                                           // isspace()
+#include <chrono>                                                           // steady_clock
+#include <cstddef>                                                          // size_t
+#include <exception>                                                        // exception_ptr, current_exception(), rethrow_exception()
+#include <format>                                                           // format()
+#include <functional>                                                       // reference_wrapper, hash, equal_to
+#include <iostream>                                                         // istream, streambuf, ws()
+#include <iterator>                                                         // istreambuf_iterator
+#include <string>                                                           // string
+#include <string_view>                                                      // string_view
+#include <thread>                                                           // jthread
+#include <unordered_set>                                                    // unordered_set
+#include <utility>                                                          // move()
+#include <vector>                                                           // vector
+
+#include "GroceryItem.hpp"
+#include "GroceryList.hpp"
+#include "GroceryListLoader.hpp"
+
+
+
+
+
+
+
+
+
+
+
+/*******************************************************************************
+**  Implementation of non-member private types, objects, and functions
+*******************************************************************************/
+namespace    // unnamed, anonymous namespace
+{
+  // A read-only stream buffer over characters owned elsewhere, so each chunk is parsed in place rather than copied into a string stream
+  struct ViewBuffer : std::streambuf
+  {
+    explicit ViewBuffer( std::string_view text )
+    {
+      auto first = const_cast<char *>( text.data() );                      // get area only, never written through
+      setg( first, first, first + text.size() );
+    }
+  };
+
+
+
+  // The outcome of parsing one chunk
+  struct ChunkResult
+  {
+    std::vector<GroceryItem> groceryItems;
+    bool                     malformed = false;                             // parsing stopped before the end of the chunk
+    std::exception_ptr       error;                                         // anything thrown while parsing, rethrown on the loading thread
+  };
+
+
+
+  // Parses every record in the chunk exactly as GroceryItem's extraction operator would
+  void parseChunk( std::string_view chunk, ChunkResult & result )
+  {
+    try
+    {
+      ViewBuffer   buffer( chunk );
+      std::istream stream( &buffer );
+
+      GroceryItem groceryItem;
+      while( true )
+      {
+        // Trailing whitespace is a clean end of chunk, anything else must be a well formed record
+        if( ( stream >> std::ws ).peek() == std::istream::traits_type::eof() )   break;
+        if( !( stream >> groceryItem ) ) { result.malformed = true;  break; }
+        result.groceryItems.push_back( std::move( groceryItem ) );
+      }
+    }
+    catch( ... )
+    {
+      result.error = std::current_exception();
+    }
+  }
+}    // unnamed, anonymous namespace
+
+
+
+
+
+
+
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Statistics
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// recordsPerSecond() const
+double GroceryListLoader::Statistics::recordsPerSecond() const noexcept
+{
+  return elapsed.count() > 0.0 ? static_cast<double>( records ) / elapsed.count() : 0.0;
+}
+
+
+
+
+
+
+
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Constructors and Destructors
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Thread Count Constructor
+GroceryListLoader::GroceryListLoader( unsigned threadCount )
+  : _threadCount( std::max( threadCount, 1u ) )                             // hardware_concurrency() may report 0 when unknown
+{}
+
+
+
+
+
+
+
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Modifiers
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// load() const
+GroceryListLoader::Statistics GroceryListLoader::load( std::istream & stream, GroceryList & groceryList ) const
+{
+  Statistics statistics;
+  auto       start = std::chrono::steady_clock::now();
+
+  // Slurp the input.  The parallel parse needs random access to it anyway, and one bulk read is the fastest way to get it.
+  std::string text( std::istreambuf_iterator<char>( stream ), {} );
+  statistics.bytes = text.size();
+
+  // A few chunks per thread smooths out uneven chunk costs, but tiny chunks cost more to coordinate than to parse
+  auto chunkCount  = std::clamp<std::size_t>( text.size() / MIN_CHUNK_SIZE, 1, std::size_t{ _threadCount } * 4 );
+  auto chunks      = splitRecords( text, chunkCount );
+  statistics.chunks = chunks.size();
+
+
+  // Parse on a pool of worker threads, each claiming the next unparsed chunk until none remain
+  std::vector<ChunkResult> results( chunks.size() );
+  {
+    std::atomic<std::size_t> nextChunk = 0;
+    auto worker = [&]
+    {
+      for( auto i = nextChunk++; i < chunks.size(); i = nextChunk++ )   parseChunk( chunks[i], results[i] );
+    };
+
+    std::vector<std::jthread> pool;
+    auto                      poolSize = std::min<std::size_t>( _threadCount, chunks.size() );
+    for( std::size_t i = 1; i < poolSize; ++i )   pool.emplace_back( worker );
+    worker();                                                               // the loading thread pulls its weight too
+  }                                                                         // jthreads join here
+
+
+  // Count the distinct grocery items the merge would add before adding any.  A grocery list holds at most GroceryList::CAPACITY
+  // grocery items, so input with more distinct records than there is room for is rejected here, leaving the grocery list as it was,
+  // rather than failing part way through the merge.
+  {
+    std::unordered_set<std::reference_wrapper<GroceryItem const>, std::hash<GroceryItem>, std::equal_to<GroceryItem>> distinct;
+    auto room = GroceryList::CAPACITY - groceryList.size();
+    for( auto const & result : results )
+    {
+      if( result.error )   std::rethrow_exception( result.error );
+
+      for( auto const & groceryItem : result.groceryItems )
+      {
+        if( groceryList.find( groceryItem ) != groceryList.size() || !distinct.insert( groceryItem ).second )   continue;
+        if( distinct.size() > room )   throw GroceryList::CapacityExceeded_Ex( std::format( "Capacity Exceeded, array capacity: {}, list size: {}, new grocery items loaded: more than {}",
+                                                                                            GroceryList::CAPACITY, groceryList.size(), room ) );
+      }
+
+      if( result.malformed )   break;
+    }
+  }
+
+
+  // Merge in the original order.  Inserting at the bottom one by one gives exactly the sequential duplicate dropping semantics, and
+  // the first malformed record ends the load just as it would end the extraction operator's loop.
+  auto sizeBefore = groceryList.size();
+  for( auto & result : results )
+  {
+    statistics.records += result.groceryItems.size();
+    for( auto & groceryItem : result.groceryItems )   groceryList.insert( std::move( groceryItem ), GroceryList::Position::BOTTOM );
+
+    if( result.malformed )   break;
+  }
+  statistics.inserted = groceryList.size() - sizeBefore;
+
+  // Leave the stream as the extraction operator would:  input exhausted and the last read failed
+  stream.setstate( std::ios::eofbit | std::ios::failbit );
+
+  statistics.elapsed = std::chrono::steady_clock::now() - start;
+  return statistics;
+}
+
+
+
+
+
+
+
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private member functions
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// splitRecords()
+std::vector<std::string_view> GroceryListLoader::splitRecords( std::string_view text, std::size_t chunkCount )
+{
+  // A record is three quoted strings and a price separated by commas.  Scan just enough of the grammar to recognize where each
+  // record ends - quote state (with std::quoted's backslash escapes), commas outside quotes, and the price token - and cut at the
+  // first record end past each target size.  This sequential scan touches each character once and does no conversions, so it is
+  // cheap next to the parse it enables to run in parallel.
+  std::vector<std::string_view> chunks;
+  if( chunkCount <= 1 ) { chunks.push_back( text );  return chunks; }
+
+  auto targetSize = text.size() / chunkCount;
+  auto isSpace    = []( char c ) { return std::isspace( static_cast<unsigned char>( c ) ) != 0; };
+
+  std::size_t chunkStart = 0;
+  bool        inQuotes   = false;
+  bool        escaped    = false;
+  bool        inPrice    = false;
+  unsigned    commas     = 0;
+
+  for( std::size_t position = 0; position < text.size(); ++position )
+  {
+    char c = text[position];
+
+    if( inQuotes )
+    {
+      if     ( escaped   )   escaped  = false;
+      else if( c == '\\' )   escaped  = true;
+      else if( c == '"'  )   inQuotes = false;
+      continue;
+    }
+
+    if( inPrice && ( isSpace( c ) || c == '"' ) )                          // the price token, and so the record, ends here
+    {
+      inPrice = false;
+      commas  = 0;
+      if( position - chunkStart >= targetSize && chunks.size() + 1 < chunkCount )
+      {
+        chunks.push_back( text.substr( chunkStart, position - chunkStart ) );
+        chunkStart = position;
+      }
+    }
+
+    if     ( c == '"'                        )   inQuotes = true;
+    else if( c == ','                        )   ++commas;
+    else if( commas == 3 && !isSpace( c )    )   inPrice  = true;
+  }
+
+  chunks.push_back( text.substr( chunkStart ) );
+  return chunks;
+}
@@ -0,0 +1,56 @@
+#pragma once                                                                                      // include guard
+
+#include <chrono>                                                                                 // duration
+#include <cstddef>                                                                                // size_t
+#include <iostream>                                                                               // istream
+#include <string_view>                                                                            // string_view
+#include <thread>                                                                                 // hardware_concurrency()
+#include <vector>
+
+#include "GroceryItem.hpp"
+#include "GroceryList.hpp"
+
+
+// A GroceryListLoader reads grocery item text (the format GroceryItem's extraction operator reads) using every available core.  The
+// input is split into record-aligned chunks (honoring std::quoted's escapes, so quotes and commas inside names never split a
+// record), the chunks are parsed concurrently by a pool of worker threads, and the parsed grocery items are then inserted in their
+// original order.  The result is exactly what GroceryList's extraction operator would produce, including dropped duplicates and
+// stopping at the first malformed record.
+//
+// A grocery list holds at most GroceryList::CAPACITY grocery items, so only input that is mostly duplicates can load.  The whole
+// input is read and parsed before the distinct grocery items are counted.  If there are more than the grocery list has room for,
+// load() throws GroceryList::CapacityExceeded_Ex and leaves the grocery list unchanged, where the extraction operator would have
+// filled the grocery list and then thrown.
+class GroceryListLoader
+{
+  public:
+    // Types
+    struct Statistics
+    {
+      std::size_t                   bytes    = 0;                                                 // input consumed
+      std::size_t                   records  = 0;                                                 // grocery items parsed
+      std::size_t                   inserted = 0;                                                 // grocery items added (records less duplicates)
+      std::size_t                   chunks   = 0;                                                 // units of parallel work
+      std::chrono::duration<double> elapsed{};                                                    // wall clock, read through merge
+
+      double recordsPerSecond() const noexcept;
+    };
+
+    static constexpr std::size_t MIN_CHUNK_SIZE = 64 * 1024;                                      // smaller inputs aren't worth splitting
+
+
+    // Constructors, destructor, and assignments
+    explicit GroceryListLoader( unsigned threadCount = std::thread::hardware_concurrency() );
+
+
+    // Modifiers
+    Statistics load( std::istream & stream, GroceryList & groceryList ) const;                    // appends to the bottom, reads stream to end of file
+
+
+  private:
+    // Helper member functions
+    static std::vector<std::string_view> splitRecords( std::string_view text, std::size_t chunkCount );
+
+    // Instance Attributes
+    unsigned _threadCount = 1;
+};
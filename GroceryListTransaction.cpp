@@ -0,0 +1,176 @@
+#include <algorithm>                                                        // find(), rotate()
+#include <cstddef>                                                          // size_t, ptrdiff_t
+#include <format>                                                           // format()
+#include <initializer_list>                                                 // initializer_list
+#include <iterator>                                                         // next()
+#include <utility>                                                          // move()
+#include <vector>                                                           // vector
+
+#include "GroceryItem.hpp"
+#include "GroceryList.hpp"
+#include "GroceryListTransaction.hpp"
+
+
+
+
+
+
+
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Constructors and Destructors
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Grocery List Constructor
+GroceryListTransaction::GroceryListTransaction( GroceryList & groceryList )
+  : _groceryList( &groceryList )
+{}
+
+
+
+
+
+
+
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Queries
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// pending() const
+std::size_t GroceryListTransaction::pending() const noexcept
+{
+  return _edits.size();
+}
+
+
+
+
+
+
+
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Modifiers
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// insert( position )
+GroceryListTransaction & GroceryListTransaction::insert( GroceryItem groceryItem, Position position )
+{
+  return insert( std::move( groceryItem ), position == Position::TOP ? 0 : BOTTOM );
+}
+
+
+
+// insert( offset )
+GroceryListTransaction & GroceryListTransaction::insert( GroceryItem groceryItem, std::size_t offsetFromTop )
+{
+  _edits.push_back( { Edit::Kind::INSERT, std::move( groceryItem ), offsetFromTop } );
+  return *this;
+}
+
+
+
+// remove( groceryItem )
+GroceryListTransaction & GroceryListTransaction::remove( GroceryItem const & groceryItem )
+{
+  _edits.push_back( { Edit::Kind::REMOVE_ITEM, groceryItem } );
+  return *this;
+}
+
+
+
+// remove( offset )
+GroceryListTransaction & GroceryListTransaction::remove( std::size_t offsetFromTop )
+{
+  _edits.push_back( { Edit::Kind::REMOVE_OFFSET, {}, offsetFromTop } );
+  return *this;
+}
+
+
+
+// moveToTop()
+GroceryListTransaction & GroceryListTransaction::moveToTop( GroceryItem const & groceryItem )
+{
+  _edits.push_back( { Edit::Kind::MOVE_TO_TOP, groceryItem } );
+  return *this;
+}
+
+
+
+// operator+=( initializer_list )
+GroceryListTransaction & GroceryListTransaction::operator+=( std::initializer_list<GroceryItem> const & rhs )
+{
+  _edits.reserve( _edits.size() + rhs.size() );
+  for( auto && groceryItem : rhs )   insert( groceryItem, Position::BOTTOM );
+  return *this;
+}
+
+
+
+// commit()
+void GroceryListTransaction::commit()
+{
+  // The recorded edits are consumed whether or not the commit succeeds
+  auto edits = std::move( _edits );
+  _edits.clear();
+
+  // Replay against a working copy.  Nothing touches the grocery list itself until replaceContents(), which either succeeds
+  // completely or leaves the grocery list unchanged.
+  std::vector<GroceryItem> working( _groceryList->begin(), _groceryList->end() );
+  working.reserve( working.size() + edits.size() );
+
+  for( auto & edit : edits )
+  {
+    auto find = [&] { return std::find( working.begin(), working.end(), edit.groceryItem ); };
+
+    switch( edit.kind )
+    {
+      case Edit::Kind::INSERT:
+      {
+        auto offsetFromTop = edit.offsetFromTop == BOTTOM ? working.size() : edit.offsetFromTop;
+        if( offsetFromTop > working.size() )   throw GroceryList::InvalidOffset_Ex( std::format( "Insertion position beyond end of current list size\n  position:     {:>2}\n  current size: {:>2}", offsetFromTop, working.size() ) );
+        if( find() == working.end() )          working.insert( std::next( working.begin(), static_cast<std::ptrdiff_t>( offsetFromTop ) ), std::move( edit.groceryItem ) );   // silently discard duplicates
+        break;
+      }
+
+      case Edit::Kind::REMOVE_ITEM:
+        if( auto found = find();  found != working.end() )   working.erase( found );
+        break;
+
+      case Edit::Kind::REMOVE_OFFSET:
+        if( edit.offsetFromTop < working.size() )   working.erase( std::next( working.begin(), static_cast<std::ptrdiff_t>( edit.offsetFromTop ) ) );
+        break;
+
+      case Edit::Kind::MOVE_TO_TOP:                                        // like GroceryList::moveToTop(), the given grocery item replaces the one found
+        if( auto found = find();  found != working.end() )
+        {
+          *found = std::move( edit.groceryItem );
+          std::rotate( working.begin(), found, std::next( found ) );
+        }
+        break;
+    }
+  }
+
+  _groceryList->replaceContents( std::move( working ) );
+}
+
+
+
+// rollback()
+void GroceryListTransaction::rollback() noexcept
+{
+  _edits.clear();
+}
@@ -0,0 +1,70 @@
+#pragma once                                                                                      // include guard
+
+#include <cstddef>                                                                                // size_t
+#include <initializer_list>                                                                       // initializer_list
+#include <vector>
+
+#include "GroceryItem.hpp"
+#include "GroceryList.hpp"
+
+
+// A GroceryListTransaction records inserts, removes, and moves against a GroceryList and applies them all at once when committed.
+// Each GroceryList modifier pays for its own duplicate scan and a full walk of all four containers to verify they agree, so a long
+// sequence of edits pays for that many walks.  A commit instead replays the recorded edits against a single working copy, then
+// rebuilds each container in one pass and verifies them once.
+//
+// Commits are all or nothing.  If any recorded edit fails (an invalid offset, say) or the result would exceed the grocery list's
+// capacity, the exception propagates and the grocery list is left exactly as it was.  Capacity is checked against the committed
+// result only, so a transaction may pass through states larger than the grocery list could hold along the way.
+//
+// Edits are applied to the grocery list as it is at commit time, not as it was when they were recorded.
+class GroceryListTransaction
+{
+  public:
+    // Types
+    using Position = GroceryList::Position;
+
+
+    // Constructors, destructor, and assignments
+    //
+    // A transaction refers to its grocery list and is discarded (not committed) if destroyed with edits still pending.
+    explicit GroceryListTransaction( GroceryList & groceryList );
+
+    GroceryListTransaction            ( GroceryListTransaction const & ) = delete;
+    GroceryListTransaction & operator=( GroceryListTransaction const & ) = delete;
+
+
+    // Queries
+    std::size_t pending() const noexcept;                                                         // number of recorded edits not yet committed
+
+
+    // Modifiers - each records an edit with the same meaning as GroceryList's member of the same name
+    GroceryListTransaction & insert   ( GroceryItem groceryItem, Position    position = Position::TOP );
+    GroceryListTransaction & insert   ( GroceryItem groceryItem, std::size_t offsetFromTop            );
+    GroceryListTransaction & remove   ( GroceryItem const & groceryItem                               );
+    GroceryListTransaction & remove   ( std::size_t offsetFromTop                                     );
+    GroceryListTransaction & moveToTop( GroceryItem const & groceryItem                               );
+
+    GroceryListTransaction & operator+=( std::initializer_list<GroceryItem> const & rhs );        // records inserts at the bottom
+
+    void commit  ();                                                                              // applies every recorded edit, strong exception guarantee
+    void rollback() noexcept;                                                                     // discards every recorded edit
+
+
+  private:
+    // Types
+    struct Edit
+    {
+      enum class Kind { INSERT, REMOVE_ITEM, REMOVE_OFFSET, MOVE_TO_TOP };
+
+      Kind        kind;
+      GroceryItem groceryItem;                                                                    // unused by REMOVE_OFFSET
+      std::size_t offsetFromTop = 0;                                                              // INSERT and REMOVE_OFFSET only, BOTTOM for INSERT at the bottom
+    };
+
+    static constexpr std::size_t BOTTOM = static_cast<std::size_t>( -1 );                         // resolved to the working size when replayed
+
+    // Instance Attributes
+    GroceryList *     _groceryList;
+    std::vector<Edit> _edits;
+};
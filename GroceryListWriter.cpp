@@ -0,0 +1,266 @@
+#include <algorithm>                                                        // min()
+#include <cerrno>                                                           // errno
+#include <charconv>                                                         // to_chars(), chars_format
+#include <cmath>                                                            // isfinite()
+#include <cstddef>                                                          // size_t
+#include <format>                                                           // format_to()
+#include <iostream>                                                         // ostream
+#include <iterator>                                                         // back_inserter()
+#include <string>                                                           // string
+#include <string_view>                                                      // string_view
+#include <system_error>                                                     // system_error, generic_category()
+
+#if __has_include( <unistd.h> )                                             // POSIX file descriptors are not available everywhere
+  #include <unistd.h>                                                       // write()
+#endif
+
+
+#include "GroceryItem.hpp"
+#include "GroceryList.hpp"
+#include "GroceryListWriter.hpp"
+
+
+
+
+
+
+
+
+
+
+
+/*******************************************************************************
+**  Implementation of non-member private types, objects, and functions
+*******************************************************************************/
+namespace    // unnamed, anonymous namespace
+{
+  // Appends text surrounded by double quotes, escaping embedded quotes and escape characters exactly as std::quoted() does so the
+  // TEXT format can be read back with GroceryList's extraction operator
+  void appendQuoted( std::string & buffer, std::string_view text )
+  {
+    buffer += '"';
+    for( char c : text )
+    {
+      if( c == '"' || c == '\\' )   buffer += '\\';
+      buffer += c;
+    }
+    buffer += '"';
+  }
+
+
+
+  // Appends text surrounded by double quotes, doubling embedded quotes per RFC 4180
+  void appendCsvQuoted( std::string & buffer, std::string_view text )
+  {
+    buffer += '"';
+    for( char c : text )
+    {
+      if( c == '"' )   buffer += '"';
+      buffer += c;
+    }
+    buffer += '"';
+  }
+
+
+
+  // Appends a JSON string literal, escaping quotes, backslashes, and control characters
+  void appendJsonString( std::string & buffer, std::string_view text )
+  {
+    buffer += '"';
+    for( char c : text )
+    {
+      switch( c )
+      {
+        case '"' :  buffer += "\\\"";  break;
+        case '\\':  buffer += "\\\\";  break;
+        case '\n':  buffer += "\\n";   break;
+        case '\r':  buffer += "\\r";   break;
+        case '\t':  buffer += "\\t";   break;
+        default:
+          if( static_cast<unsigned char>( c ) < 0x20 )   std::format_to( std::back_inserter( buffer ), "\\u{:04x}", static_cast<unsigned>( c ) );
+          else                                           buffer += c;
+      }
+    }
+    buffer += '"';
+  }
+
+
+
+  // Appends a price.  The TEXT format matches an ostream's default floating point formatting (%g with 6 significant digits), the
+  // others use the shortest representation that round trips.
+  void appendPrice( std::string & buffer, double price, GroceryListWriter::Format format )
+  {
+    char digits[64];
+    auto result = format == GroceryListWriter::Format::TEXT
+                ? std::to_chars( std::begin( digits ), std::end( digits ), price, std::chars_format::general, 6 )
+                : std::to_chars( std::begin( digits ), std::end( digits ), price );
+    buffer.append( digits, result.ptr );
+  }
+}    // unnamed, anonymous namespace
+
+
+
+
+
+
+
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Constructors and Destructors
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Stream Constructor
+GroceryListWriter::GroceryListWriter( std::ostream & stream, Format format, std::size_t bufferSize )
+  : _stream( &stream ), _format( format ), _bufferSize( std::max<std::size_t>( bufferSize, 1 ) )
+{
+  _buffer.reserve( _bufferSize + 1024 );                                    // one formatted item may spill past the threshold before the buffer is drained
+}
+
+
+
+// File Descriptor Constructor
+GroceryListWriter::GroceryListWriter( int fileDescriptor, Format format, std::size_t bufferSize )
+  : _fileDescriptor( fileDescriptor ), _format( format ), _bufferSize( std::max<std::size_t>( bufferSize, 1 ) )
+{
+  _buffer.reserve( _bufferSize + 1024 );
+}
+
+
+
+// Destructor
+GroceryListWriter::~GroceryListWriter() noexcept
+{
+  try                 { flush(); }
+  catch( ... )        {}                                                    // destructors must not throw, call flush() explicitly to observe errors
+}
+
+
+
+
+
+
+
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Modifiers
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// write()
+std::size_t GroceryListWriter::write( GroceryList const & groceryList, std::size_t offset, std::size_t count )
+{
+  // size() also verifies the grocery list's internal consistency.  Iteration is random access, so pagination starts at the offset
+  // without walking the list.
+  auto size = groceryList.size();
+  if( offset >= size )   return 0;
+
+  auto last = offset + std::min( count, size - offset );
+
+  // CSV gets a header row, but only on the first page so pages can simply be concatenated
+  if( _format == Format::CSV && offset == 0 )   _buffer += "upc,brand,product,price\n";
+
+  for( auto i = offset; i < last; ++i )
+  {
+    append( groceryList[i], i );
+    if( _buffer.size() >= _bufferSize )   drainSink();
+  }
+
+  return last - offset;
+}
+
+
+
+// flush()
+void GroceryListWriter::flush()
+{
+  drainSink();
+  if( _stream != nullptr )   _stream->flush();
+}
+
+
+
+
+
+
+
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private member functions
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// append()
+void GroceryListWriter::append( GroceryItem const & groceryItem, std::size_t offsetFromTop )
+{
+  switch( _format )
+  {
+    case Format::TEXT:                                                      // same layout as GroceryList's insertion operator
+      std::format_to( std::back_inserter( _buffer ), "\n{:>5}:  ", offsetFromTop );
+      appendQuoted( _buffer, groceryItem.upcCode()     );   _buffer += ", ";
+      appendQuoted( _buffer, groceryItem.brandName()   );   _buffer += ", ";
+      appendQuoted( _buffer, groceryItem.productName() );   _buffer += ", ";
+      appendPrice ( _buffer, groceryItem.price(), _format );
+      break;
+
+    case Format::CSV:
+      appendCsvQuoted( _buffer, groceryItem.upcCode()     );   _buffer += ',';
+      appendCsvQuoted( _buffer, groceryItem.brandName()   );   _buffer += ',';
+      appendCsvQuoted( _buffer, groceryItem.productName() );   _buffer += ',';
+      appendPrice    ( _buffer, groceryItem.price(), _format );
+      _buffer += '\n';
+      break;
+
+    case Format::JSON_LINES:
+      _buffer += "{\"upc\":";       appendJsonString( _buffer, groceryItem.upcCode()     );
+      _buffer += ",\"brand\":";     appendJsonString( _buffer, groceryItem.brandName()   );
+      _buffer += ",\"product\":";   appendJsonString( _buffer, groceryItem.productName() );
+      _buffer += ",\"price\":";
+      if( std::isfinite( groceryItem.price() ) )   appendPrice( _buffer, groceryItem.price(), _format );
+      else                                          _buffer += "null";   // JSON has no representation for infinity or NaN
+      _buffer += "}\n";
+      break;
+  }
+}
+
+
+
+// drainSink()
+void GroceryListWriter::drainSink()
+{
+  if( _buffer.empty() )   return;
+
+  if( _stream != nullptr )
+  {
+    _stream->write( _buffer.data(), static_cast<std::streamsize>( _buffer.size() ) );   // stream errors are reported through the stream's state, as usual
+  }
+  else
+  {
+    #if __has_include( <unistd.h> )
+      std::string_view pending = _buffer;
+      while( !pending.empty() )
+      {
+        auto written = ::write( _fileDescriptor, pending.data(), pending.size() );
+        if( written < 0 )
+        {
+          if( errno == EINTR )   continue;
+          throw std::system_error( errno, std::generic_category(), "GroceryListWriter failed writing to file descriptor" );
+        }
+        pending.remove_prefix( static_cast<std::size_t>( written ) );
+      }
+    #else
+      throw std::system_error( std::make_error_code( std::errc::function_not_supported ), "GroceryListWriter file descriptors require POSIX" );
+    #endif
+  }
+
+  _buffer.clear();                                                          // keeps the capacity for reuse
+}
@@ -0,0 +1,53 @@
+#pragma once                                                                                      // include guard
+
+#include <cstddef>                                                                                // size_t
+#include <iostream>                                                                               // ostream
+#include <limits>                                                                                 // numeric_limits
+#include <string>                                                                                 // string
+
+#include "GroceryItem.hpp"
+#include "GroceryList.hpp"
+
+
+// A GroceryListWriter formats grocery items into one large, reusable character buffer and hands that buffer to the underlying
+// stream (or file descriptor) in big chunks.  Unlike GroceryList's insertion operator, no formatted iostream insertions are made
+// per grocery item, so dumping a large grocery list is limited by the sink rather than by the formatting.
+//
+// The TEXT format reproduces GroceryList's insertion operator layout exactly (default stream formatting state assumed).  CSV and
+// JSON_LINES are provided for interchange with other tools.  Pagination (offset, count) lets huge lists be streamed in pieces.
+class GroceryListWriter
+{
+  public:
+    // Types and Constants
+    enum class Format {TEXT, CSV, JSON_LINES};
+
+    static constexpr std::size_t DEFAULT_BUFFER_SIZE = 64 * 1024;                                 // bytes accumulated before handing off to the sink
+    static constexpr std::size_t ALL                 = std::numeric_limits<std::size_t>::max();   // write every grocery item from offset to the bottom
+
+
+    // Constructors, destructor, and assignments
+    GroceryListWriter( std::ostream & stream,         Format format = Format::TEXT, std::size_t bufferSize = DEFAULT_BUFFER_SIZE );
+    GroceryListWriter( int            fileDescriptor, Format format = Format::TEXT, std::size_t bufferSize = DEFAULT_BUFFER_SIZE );   // POSIX file descriptor, not closed by the writer
+
+    GroceryListWriter            ( GroceryListWriter const & ) = delete;                          // a writer owns its buffer and is bound to one sink
+    GroceryListWriter & operator=( GroceryListWriter const & ) = delete;
+   ~GroceryListWriter() noexcept;                                                                 // flushes whatever remains buffered, errors are swallowed
+
+
+    // Modifiers
+    std::size_t write( GroceryList const & groceryList, std::size_t offset = 0, std::size_t count = ALL );   // returns the number of grocery items written
+    void        flush();                                                                          // hands everything buffered to the sink
+
+
+  private:
+    // Helper member functions
+    void append   ( GroceryItem const & groceryItem, std::size_t offsetFromTop );                 // formats one grocery item into the buffer
+    void drainSink();                                                                             // empties the buffer into the sink
+
+    // Instance Attributes
+    std::ostream * _stream         = nullptr;                                                     // exactly one of _stream and _fileDescriptor is in use
+    int            _fileDescriptor = -1;
+    Format         _format         = Format::TEXT;
+    std::size_t    _bufferSize     = DEFAULT_BUFFER_SIZE;
+    std::string    _buffer;                                                                       // reused across write() calls
+};
@@ -0,0 +1,551 @@
+#include <algorithm>                                                        // min()
+#include <compare>                                                          // weak_ordering
+#include <cstddef>                                                          // size_t
+#include <format>                                                           // format()
+#include <functional>                                                       // hash
+#include <initializer_list>                                                 // initializer_list
+#include <iomanip>                                                          // setw()
+#include <iostream>                                                         // istream, ostream
+#include <utility>                                                          // exchange(), move(), swap()
+
+#include "GroceryItem.hpp"
+#include "GroceryList.hpp"
+#include "RankedGroceryList.hpp"
+
+
+
+
+
+
+
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Iterator
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// operator*() const
+RankedGroceryList::const_iterator::reference RankedGroceryList::const_iterator::operator*() const noexcept
+{
+  return _node->groceryItem;
+}
+
+
+
+// operator->() const
+RankedGroceryList::const_iterator::pointer RankedGroceryList::const_iterator::operator->() const noexcept
+{
+  return &_node->groceryItem;
+}
+
+
+
+// operator++()
+RankedGroceryList::const_iterator & RankedGroceryList::const_iterator::operator++() noexcept
+{
+  // In-order successor:  the leftmost node of the right subtree if there is one, otherwise the first ancestor reached from its left
+  if( _node->right != nullptr )
+  {
+    _node = _node->right;
+    while( _node->left != nullptr )   _node = _node->left;
+  }
+  else
+  {
+    while( _node->parent != nullptr && _node == _node->parent->right )   _node = _node->parent;
+    _node = _node->parent;
+  }
+  return *this;
+}
+
+
+
+// operator++( int )
+RankedGroceryList::const_iterator RankedGroceryList::const_iterator::operator++( int ) noexcept
+{
+  auto previous = *this;
+  ++*this;
+  return previous;
+}
+
+
+
+
+
+
+
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Constructors and Destructors
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Initializer List Constructor
+RankedGroceryList::RankedGroceryList( std::initializer_list<GroceryItem> const & initList )
+{
+  for( auto && groceryItem : initList )   insert( groceryItem, Position::BOTTOM );
+}
+
+
+
+// Copy Constructor
+RankedGroceryList::RankedGroceryList( RankedGroceryList const & other )
+  : _root( clone( other._root, nullptr ) ), _priorities( other._priorities )
+{
+  reindex();
+}
+
+
+
+// Move Constructor
+RankedGroceryList::RankedGroceryList( RankedGroceryList && other ) noexcept
+  : _root( std::exchange( other._root, nullptr ) ), _index( std::move( other._index ) ), _priorities( other._priorities )
+{
+  other._index.clear();
+}
+
+
+
+// Copy Assignment Operator
+RankedGroceryList & RankedGroceryList::operator=( RankedGroceryList const & rhs )
+{
+  if( this != &rhs )   *this = RankedGroceryList( rhs );                    // copy and swap (via move assignment) for the strong guarantee
+  return *this;
+}
+
+
+
+// Move Assignment Operator
+RankedGroceryList & RankedGroceryList::operator=( RankedGroceryList && rhs ) noexcept
+{
+  if( this != &rhs )
+  {
+    std::swap( _root,       rhs._root       );
+    std::swap( _index,      rhs._index      );
+    std::swap( _priorities, rhs._priorities );
+  }
+  return *this;
+}
+
+
+
+// Destructor
+RankedGroceryList::~RankedGroceryList() noexcept
+{
+  destroy( _root );
+}
+
+
+
+
+
+
+
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Queries
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// size() const
+std::size_t RankedGroceryList::size() const noexcept
+{
+  return sizeOf( _root );
+}
+
+
+
+
+
+
+
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Accessors
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// find() const
+std::size_t RankedGroceryList::find( GroceryItem const & groceryItem ) const
+{
+  auto node = findNode( groceryItem );
+  return node == nullptr ? size() : rankOf( node );
+}
+
+
+
+// at() const
+GroceryItem const & RankedGroceryList::at( std::size_t offsetFromTop ) const
+{
+  if( offsetFromTop >= size() )   throw InvalidOffset_Ex( std::format( "Access position beyond end of current list size\n  position:     {:>2}\n  current size: {:>2}", offsetFromTop, size() ) );
+  return nodeAt( offsetFromTop )->groceryItem;
+}
+
+
+
+// begin() const
+RankedGroceryList::const_iterator RankedGroceryList::begin() const noexcept
+{
+  auto node = _root;
+  if( node != nullptr )   while( node->left != nullptr )   node = node->left;
+  return const_iterator( node );
+}
+
+
+
+// end() const
+RankedGroceryList::const_iterator RankedGroceryList::end() const noexcept
+{
+  return const_iterator( nullptr );
+}
+
+
+
+
+
+
+
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Modifiers
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// insert( position )
+void RankedGroceryList::insert( GroceryItem const & groceryItem, Position position )
+{
+  if( position == Position::TOP )   insert( groceryItem, 0      );
+  else                              insert( groceryItem, size() );
+}
+
+
+
+// insert( offset )
+void RankedGroceryList::insert( GroceryItem const & groceryItem, std::size_t offsetFromTop )
+{
+  if( offsetFromTop > size() )   throw InvalidOffset_Ex( std::format( "Insertion position beyond end of current list size\n  position:     {:>2}\n  current size: {:>2}", offsetFromTop, size() ) );
+
+  // Prevent duplicate entries
+  if( findNode( groceryItem ) != nullptr )   return;
+
+  // Allocate and index first so nothing in the tree changes if either throws
+  auto node = new Node{ groceryItem, _priorities() };
+  try                   { _index.emplace( std::hash<GroceryItem>{}( groceryItem ), node ); }
+  catch( ... )          { delete node;  throw; }
+
+  // Split the tree at the offset and splice the new node in between the halves
+  Node * left  = nullptr;
+  Node * right = nullptr;
+  split( _root, offsetFromTop, left, right );
+  _root = merge( merge( left, node ), right );
+  _root->parent = nullptr;
+}
+
+
+
+// remove( groceryItem )
+void RankedGroceryList::remove( GroceryItem const & groceryItem )
+{
+  remove( find( groceryItem ) );
+}
+
+
+
+// remove( offset )
+void RankedGroceryList::remove( std::size_t offsetFromTop )
+{
+  if( offsetFromTop >= size() )   return;
+
+  // Carve the tree into [0, offset), [offset], and [offset+1, size), then rejoin the outer pieces
+  Node * left   = nullptr;
+  Node * middle = nullptr;
+  Node * right  = nullptr;
+  split( _root,  offsetFromTop, left,   right );
+  split( right,  1,             middle, right );
+
+  _root = merge( left, right );
+  if( _root != nullptr )   _root->parent = nullptr;
+
+  auto [first, last] = _index.equal_range( std::hash<GroceryItem>{}( middle->groceryItem ) );
+  for( ; first != last; ++first )   if( first->second == middle ) { _index.erase( first );  break; }
+
+  delete middle;
+}
+
+
+
+// moveToTop()
+void RankedGroceryList::moveToTop( GroceryItem const & groceryItem )
+{
+  auto offset = find( groceryItem );
+  if( offset != size() )
+  {
+    remove( offset );
+    insert( groceryItem, Position::TOP );
+  }
+}
+
+
+
+// operator+=( initializer_list )
+RankedGroceryList & RankedGroceryList::operator+=( std::initializer_list<GroceryItem> const & rhs )
+{
+  for( auto && groceryItem : rhs )   insert( groceryItem, Position::BOTTOM );
+  return *this;
+}
+
+
+
+// operator+=( RankedGroceryList )
+RankedGroceryList & RankedGroceryList::operator+=( RankedGroceryList const & rhs )
+{
+  if( this == &rhs )   return *this;                                        // every grocery item would be a duplicate
+  for( auto && groceryItem : rhs )   insert( groceryItem, Position::BOTTOM );
+  return *this;
+}
+
+
+
+
+
+
+
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Relational Operators
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// operator<=>
+std::weak_ordering RankedGroceryList::operator<=>( RankedGroceryList const & rhs ) const
+{
+  auto lhsCurrent = begin();
+  auto rhsCurrent = rhs.begin();
+  for( ; lhsCurrent != end() && rhsCurrent != rhs.end(); ++lhsCurrent, ++rhsCurrent )
+  {
+    auto cmp = *lhsCurrent <=> *rhsCurrent;
+    if( cmp != 0 )   return cmp;
+  }
+  return size() <=> rhs.size();
+}
+
+
+
+// operator==
+bool RankedGroceryList::operator==( RankedGroceryList const & rhs ) const
+{
+  if( size() != rhs.size() )   return false;
+
+  auto rhsCurrent = rhs.begin();
+  for( auto && groceryItem : *this )   if( groceryItem != *rhsCurrent++ )   return false;
+  return true;
+}
+
+
+
+
+
+
+
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private member functions
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// sizeOf()
+std::size_t RankedGroceryList::sizeOf( Node const * node ) noexcept
+{
+  return node == nullptr ? 0 : node->subtreeSize;
+}
+
+
+
+// update()
+void RankedGroceryList::update( Node * node ) noexcept
+{
+  node->subtreeSize = 1 + sizeOf( node->left ) + sizeOf( node->right );
+  if( node->left  != nullptr )   node->left ->parent = node;
+  if( node->right != nullptr )   node->right->parent = node;
+}
+
+
+
+// split()
+void RankedGroceryList::split( Node * node, std::size_t count, Node * & left, Node * & right ) noexcept
+{
+  if( node == nullptr ) { left = right = nullptr;  return; }
+
+  if( sizeOf( node->left ) < count )
+  {
+    split( node->right, count - sizeOf( node->left ) - 1, node->right, right );
+    left = node;
+  }
+  else
+  {
+    split( node->left, count, left, node->left );
+    right = node;
+  }
+
+  update( node );
+  if( left  != nullptr )   left ->parent = nullptr;                         // the caller re-parents the pieces it keeps
+  if( right != nullptr )   right->parent = nullptr;
+}
+
+
+
+// merge()
+RankedGroceryList::Node * RankedGroceryList::merge( Node * left, Node * right ) noexcept
+{
+  if( left  == nullptr )   return right;
+  if( right == nullptr )   return left;
+
+  if( left->priority > right->priority )
+  {
+    left->right = merge( left->right, right );
+    update( left );
+    return left;
+  }
+
+  right->left = merge( left, right->left );
+  update( right );
+  return right;
+}
+
+
+
+// clone()
+RankedGroceryList::Node * RankedGroceryList::clone( Node const * node, Node * parent )
+{
+  if( node == nullptr )   return nullptr;
+
+  auto copy = new Node{ node->groceryItem, node->priority, node->subtreeSize, nullptr, nullptr, parent };
+  try
+  {
+    copy->left  = clone( node->left,  copy );
+    copy->right = clone( node->right, copy );
+  }
+  catch( ... )
+  {
+    destroy( copy );
+    throw;
+  }
+  return copy;
+}
+
+
+
+// destroy()
+void RankedGroceryList::destroy( Node * node ) noexcept
+{
+  if( node == nullptr )   return;
+  destroy( node->left  );
+  destroy( node->right );
+  delete node;
+}
+
+
+
+// findNode() const
+RankedGroceryList::Node * RankedGroceryList::findNode( GroceryItem const & groceryItem ) const
+{
+  auto [first, last] = _index.equal_range( std::hash<GroceryItem>{}( groceryItem ) );
+  for( ; first != last; ++first )   if( first->second->groceryItem == groceryItem )   return first->second;
+  return nullptr;
+}
+
+
+
+// nodeAt() const
+RankedGroceryList::Node * RankedGroceryList::nodeAt( std::size_t offsetFromTop ) const noexcept
+{
+  auto node = _root;
+  while( node != nullptr )
+  {
+    auto leftSize = sizeOf( node->left );
+    if     ( offsetFromTop <  leftSize )   node = node->left;
+    else if( offsetFromTop == leftSize )   return node;
+    else { offsetFromTop -= leftSize + 1;  node = node->right; }
+  }
+  return nullptr;
+}
+
+
+
+// rankOf() const
+std::size_t RankedGroceryList::rankOf( Node const * node ) const noexcept
+{
+  // Everything in the left subtree precedes the node, plus every ancestor (and its left subtree) reached by climbing from the right
+  auto rank = sizeOf( node->left );
+  for( ; node->parent != nullptr; node = node->parent )
+  {
+    if( node == node->parent->right )   rank += sizeOf( node->parent->left ) + 1;
+  }
+  return rank;
+}
+
+
+
+// reindex()
+void RankedGroceryList::reindex()
+{
+  _index.clear();
+  _index.reserve( size() );
+  for( auto current = begin(); current != end(); ++current )   _index.emplace( std::hash<GroceryItem>{}( *current ), const_cast<Node *>( current._node ) );
+}
+
+
+
+
+
+
+
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Non-member functions
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// operator<<
+std::ostream & operator<<( std::ostream & stream, RankedGroceryList const & groceryList )
+{
+  // Same layout as GroceryList's insertion operator
+  unsigned count = 0;
+  for( auto && groceryItem : groceryList )   stream << '\n' << std::setw(5) << count++ << ":  " << groceryItem;
+
+  return stream;
+}
+
+
+
+// operator>>
+std::istream & operator>>( std::istream & stream, RankedGroceryList & groceryList )
+{
+  GroceryItem temp;
+  while( stream >> temp )   groceryList.insert( temp, RankedGroceryList::Position::BOTTOM );
+
+  return stream;
+}
@@ -0,0 +1,135 @@
+#pragma once                                                                                      // include guard
+
+#include <compare>                                                                                // weak_ordering
+#include <cstddef>                                                                                // size_t, ptrdiff_t
+#include <cstdint>                                                                                // uint64_t
+#include <initializer_list>                                                                       // initializer_list
+#include <iostream>                                                                               // istream, ostream
+#include <iterator>                                                                               // forward_iterator_tag
+#include <random>                                                                                 // mt19937_64
+#include <unordered_map>                                                                          // unordered_multimap
+
+#include "GroceryItem.hpp"
+#include "GroceryList.hpp"
+
+
+// A RankedGroceryList offers GroceryList's interface backed by an order-statistic tree (an implicit treap: a randomized balanced
+// binary tree ordered by position, where each node records the size of its subtree).  Positional insert, remove, and access are
+// O(log N) expected, rather than O(N), so mid-list insertions like  insert( item, find( bread ) )  stay cheap on long lists.  A
+// hash index over grocery item identities makes find() and duplicate prevention O(log N) as well.
+//
+// Unlike GroceryList, there is no fixed capacity.
+class RankedGroceryList
+{
+  // Insertion and Extraction Operators
+  friend std::ostream & operator<<( std::ostream & stream, RankedGroceryList const & groceryList );
+  friend std::istream & operator>>( std::istream & stream, RankedGroceryList       & groceryList );
+
+  private:
+    struct Node;
+
+  public:
+    // Types and Exceptions
+    using Position                = GroceryList::Position;
+    using InvalidInternalState_Ex = GroceryList::InvalidInternalState_Ex;
+    using InvalidOffset_Ex        = GroceryList::InvalidOffset_Ex;
+
+    class const_iterator                                                                          // in-order (top to bottom) traversal
+    {
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = GroceryItem;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = GroceryItem const *;
+        using reference         = GroceryItem const &;
+
+        const_iterator() = default;
+
+        reference        operator* () const noexcept;
+        pointer          operator->() const noexcept;
+        const_iterator & operator++()      noexcept;
+        const_iterator   operator++( int ) noexcept;
+        bool             operator==( const_iterator const & ) const noexcept = default;
+
+      private:
+        friend class RankedGroceryList;
+        explicit const_iterator( Node const * node ) noexcept : _node( node ) {}
+
+        Node const * _node = nullptr;
+    };
+
+
+
+    // Constructors, destructor, and assignments
+    //
+    // The tree owns its nodes through raw pointers (parent links make unique_ptr awkward), so the 'Rule of 5' applies.
+    RankedGroceryList() = default;                                                                // constructs an empty grocery list
+    RankedGroceryList( std::initializer_list<GroceryItem> const & initList );                     // constructs a grocery list from a braced list of grocery items
+
+    RankedGroceryList            ( RankedGroceryList const  & other );
+    RankedGroceryList            ( RankedGroceryList       && other ) noexcept;
+    RankedGroceryList & operator=( RankedGroceryList const  & rhs   );
+    RankedGroceryList & operator=( RankedGroceryList       && rhs   ) noexcept;
+   ~RankedGroceryList            (                                  ) noexcept;
+
+
+    // Queries
+    std::size_t size() const noexcept;                                                            // O(1)
+
+
+    // Accessors
+    std::size_t         find ( GroceryItem const & groceryItem ) const;                           // O(log N), returns size() if grocery item not found
+    GroceryItem const & at   ( std::size_t offsetFromTop       ) const;                           // O(log N), throws InvalidOffset_Ex if offsetFromTop >= size()
+
+    const_iterator      begin() const noexcept;
+    const_iterator      end  () const noexcept;
+
+
+    // Modifiers
+    void insert   ( GroceryItem const & groceryItem, Position    position = Position::TOP );      // O(log N) expected
+    void insert   ( GroceryItem const & groceryItem, std::size_t offsetFromTop            );      // O(log N) expected, inserts before the grocery item currently at that offset
+
+    void remove   ( GroceryItem const & groceryItem                                       );      // no change occurs if grocery item not found
+    void remove   ( std::size_t         offsetFromTop                                     );      // no change occurs if (zero-based) offsetFromTop >= size()
+
+    void moveToTop( GroceryItem const & groceryItem                                       );
+
+    RankedGroceryList & operator+=( std::initializer_list<GroceryItem> const & rhs );
+    RankedGroceryList & operator+=( RankedGroceryList                  const & rhs );
+
+
+    // Relational Operators
+    std::weak_ordering operator<=>( RankedGroceryList const & rhs ) const;
+    bool               operator== ( RankedGroceryList const & rhs ) const;
+
+
+  private:
+    // Types
+    struct Node
+    {
+      GroceryItem   groceryItem;
+      std::uint64_t priority;                                                                     // heap ordered, random, keeps the tree balanced in expectation
+      std::size_t   subtreeSize = 1;
+      Node *        left        = nullptr;
+      Node *        right       = nullptr;
+      Node *        parent      = nullptr;
+    };
+
+    // Helper member functions
+    static std::size_t sizeOf ( Node const * node ) noexcept;
+    static void        update ( Node       * node ) noexcept;                                     // recomputes subtreeSize and re-parents children
+    static void        split  ( Node * node, std::size_t count, Node * & left, Node * & right ) noexcept;   // left receives the first count nodes
+    static Node *      merge  ( Node * left, Node * right ) noexcept;
+    static Node *      clone  ( Node const * node, Node * parent );
+    static void        destroy( Node * node ) noexcept;
+
+    Node *      findNode( GroceryItem const & groceryItem ) const;
+    Node *      nodeAt  ( std::size_t offsetFromTop       ) const noexcept;
+    std::size_t rankOf  ( Node const * node               ) const noexcept;
+    void        reindex ();
+
+    // Instance Attributes
+    Node *                                        _root = nullptr;
+    std::unordered_multimap<std::size_t, Node *>  _index;                                         // grocery item identity hash -> node
+    std::mt19937_64                               _priorities{ 0x5eed };
+};
@@ -0,0 +1,223 @@
+#include <algorithm>                                                        // max()
+#include <cstddef>                                                          // size_t
+#include <functional>                                                       // hash
+#include <initializer_list>                                                 // initializer_list
+#include <iomanip>                                                          // setw()
+#include <iostream>                                                         // ostream
+#include <mutex>                                                            // mutex, scoped_lock, unique_lock
+#include <string>                                                           // string
+#include <vector>                                                           // vector
+
+#include "GroceryItem.hpp"
+#include "GroceryList.hpp"
+#include "ShardedGroceryList.hpp"
+
+
+
+
+
+
+
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Constructors and Destructors
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Default Constructor
+ShardedGroceryList::ShardedGroceryList( std::size_t shardCount )
+  : _shards( std::max<std::size_t>( shardCount, 1 ) )                       // hardware_concurrency() may report 0 when unknown
+{}
+
+
+
+// Initializer List Constructor
+ShardedGroceryList::ShardedGroceryList( std::initializer_list<GroceryItem> const & initList, std::size_t shardCount )
+  : ShardedGroceryList( shardCount )
+{
+  *this += initList;
+}
+
+
+
+
+
+
+
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Queries
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// size() const
+std::size_t ShardedGroceryList::size() const
+{
+  // Shards are visited one at a time, so concurrent modifications of other shards may or may not be counted
+  std::size_t total = 0;
+  for( auto & shard : _shards )
+  {
+    std::scoped_lock lock( shard.mutex );
+    total += shard.groceryList.size();
+  }
+  return total;
+}
+
+
+
+// shardCount() const
+std::size_t ShardedGroceryList::shardCount() const noexcept
+{
+  return _shards.size();
+}
+
+
+
+// shardOf() const
+std::size_t ShardedGroceryList::shardOf( GroceryItem const & groceryItem ) const noexcept
+{
+  return std::hash<std::string>{}( groceryItem.upcCode() ) % _shards.size();
+}
+
+
+
+
+
+
+
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Accessors
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// contains() const
+bool ShardedGroceryList::contains( GroceryItem const & groceryItem ) const
+{
+  auto & shard = shardFor( groceryItem );
+  std::scoped_lock lock( shard.mutex );
+  return shard.groceryList.find( groceryItem ) != shard.groceryList.size();
+}
+
+
+
+// items() const
+std::vector<GroceryItem> ShardedGroceryList::items() const
+{
+  // Hold every shard's lock so the snapshot reflects a single point in time.  Locks are always acquired in shard order, and single
+  // shard operations never hold more than one, so this cannot deadlock.
+  std::vector<std::unique_lock<std::mutex>> locks;
+  locks.reserve( _shards.size() );
+  for( auto & shard : _shards )   locks.emplace_back( shard.mutex );
+
+  std::vector<GroceryItem> merged;
+  for( auto & shard : _shards )   merged.insert( merged.end(), shard.groceryList.begin(), shard.groceryList.end() );
+  return merged;
+}
+
+
+
+
+
+
+
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Modifiers
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// insert()
+void ShardedGroceryList::insert( GroceryItem const & groceryItem, Position position )
+{
+  auto & shard = shardFor( groceryItem );
+  std::scoped_lock lock( shard.mutex );
+  shard.groceryList.insert( groceryItem, position );
+}
+
+
+
+// remove()
+void ShardedGroceryList::remove( GroceryItem const & groceryItem )
+{
+  auto & shard = shardFor( groceryItem );
+  std::scoped_lock lock( shard.mutex );
+  shard.groceryList.remove( groceryItem );
+}
+
+
+
+// moveToTop()
+void ShardedGroceryList::moveToTop( GroceryItem const & groceryItem )
+{
+  auto & shard = shardFor( groceryItem );
+  std::scoped_lock lock( shard.mutex );
+  shard.groceryList.moveToTop( groceryItem );
+}
+
+
+
+// operator+=( initializer_list )
+ShardedGroceryList & ShardedGroceryList::operator+=( std::initializer_list<GroceryItem> const & rhs )
+{
+  for( auto && groceryItem : rhs )   insert( groceryItem, Position::BOTTOM );
+  return *this;
+}
+
+
+
+
+
+
+
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private member functions
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// shardFor() const
+ShardedGroceryList::Shard & ShardedGroceryList::shardFor( GroceryItem const & groceryItem ) const noexcept
+{
+  return _shards[ shardOf( groceryItem ) ];
+}
+
+
+
+
+
+
+
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Non-member functions
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// operator<<
+std::ostream & operator<<( std::ostream & stream, ShardedGroceryList const & shardedList )
+{
+  // Same layout as GroceryList's insertion operator, numbered across the merged view
+  unsigned count = 0;
+  for( auto && groceryItem : shardedList.items() )   stream << '\n' << std::setw(5) << count++ << ":  " << groceryItem;
+
+  return stream;
+}
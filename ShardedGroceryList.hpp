@@ -0,0 +1,98 @@
+#pragma once                                                                                      // include guard
+
+#include <cstddef>                                                                                // size_t
+#include <initializer_list>                                                                       // initializer_list
+#include <iostream>                                                                               // ostream
+#include <mutex>                                                                                  // mutex, scoped_lock
+#include <thread>                                                                                 // hardware_concurrency()
+#include <vector>
+
+#include "GroceryItem.hpp"
+#include "GroceryList.hpp"
+
+
+// A ShardedGroceryList partitions grocery items across independent GroceryLists (shards) by a hash of the grocery item's UPC.  Each
+// shard has its own lock, so inserts, removes, and finds that land on different shards proceed in parallel.  Equal grocery items
+// always hash to the same shard, so each shard's duplicate prevention also prevents duplicates across the whole sharded list.
+//
+// Ordering is maintained within a shard only.  The merged view presents shard 0's grocery items (top to bottom), then shard 1's,
+// and so on.
+class ShardedGroceryList
+{
+  // Insertion Operator
+  friend std::ostream & operator<<( std::ostream & stream, ShardedGroceryList const & shardedList );
+
+  public:
+    // Types
+    using Position = GroceryList::Position;
+
+
+    // Constructors, destructor, and assignments
+    //
+    // Shards own a mutex, so sharded lists can be neither copied nor moved.  Use items() to take a copy of the contents.
+    explicit ShardedGroceryList( std::size_t shardCount = std::thread::hardware_concurrency() );                                     // constructs an empty sharded list
+             ShardedGroceryList( std::initializer_list<GroceryItem> const & initList,
+                                 std::size_t shardCount = std::thread::hardware_concurrency() );                                     // constructs a sharded list from a braced list of grocery items
+
+    ShardedGroceryList            ( ShardedGroceryList const & ) = delete;
+    ShardedGroceryList & operator=( ShardedGroceryList const & ) = delete;
+
+
+    // Queries
+    std::size_t size      () const;                                                               // aggregate number of grocery items across all shards
+    std::size_t shardCount() const noexcept;                                                      // number of independent shards
+    std::size_t shardOf   ( GroceryItem const & groceryItem ) const noexcept;                     // the shard a grocery item is (or would be) stored in
+
+
+    // Accessors
+    bool                     contains( GroceryItem const & groceryItem ) const;                   // locks only the grocery item's shard
+    std::vector<GroceryItem> items   (                                 ) const;                   // consistent snapshot of the merged view
+
+    template<typename Visitor>
+    void                     forEach ( Visitor && visitor              ) const;                   // visits the merged view one shard at a time, holding only that shard's lock
+
+
+    // Modifiers
+    void insert   ( GroceryItem const & groceryItem, Position position = Position::TOP );         // inserts at the top or bottom of the grocery item's shard
+    void remove   ( GroceryItem const & groceryItem                                     );        // no change occurs if grocery item not found
+    void moveToTop( GroceryItem const & groceryItem                                     );        // moves to the top of the grocery item's shard
+
+    ShardedGroceryList & operator+=( std::initializer_list<GroceryItem> const & rhs );            // inserts each grocery item at the bottom of its shard
+
+
+  private:
+    // Types
+    struct Shard
+    {
+      mutable std::mutex mutex;
+      GroceryList        groceryList;
+    };
+
+    // Helper member functions
+    Shard & shardFor( GroceryItem const & groceryItem ) const noexcept;
+
+    // Instance Attributes
+    mutable std::vector<Shard> _shards;                                                           // sized once at construction and never reallocated
+};
+
+
+
+
+
+
+
+
+/*******************************************************************************
+**  Template definitions
+*******************************************************************************/
+
+// forEach()
+template<typename Visitor>
+void ShardedGroceryList::forEach( Visitor && visitor ) const
+{
+  for( auto & shard : _shards )
+  {
+    std::scoped_lock lock( shard.mutex );
+    for( auto const & groceryItem : shard.groceryList )   visitor( groceryItem );
+  }
+}
@@ -0,0 +1,466 @@
+#include <algorithm>                                                        // min()
+#include <atomic>                                                           // atomic_thread_fence(), memory_order
+#include <cerrno>                                                           // errno
+#include <cstddef>                                                          // size_t, byte
+#include <cstdint>                                                          // uint32_t, uint64_t
+#include <cstring>                                                          // memcpy()
+#include <format>                                                           // format()
+#include <limits>                                                           // numeric_limits
+#include <new>                                                              // placement new
+#include <string>                                                           // string
+#include <string_view>                                                      // string_view
+#include <system_error>                                                     // system_error, generic_category()
+#include <utility>                                                          // exchange(), move()
+#include <vector>                                                           // vector
+
+#if __has_include( <sys/mman.h> )                                           // POSIX shared memory is not available everywhere
+  #include <fcntl.h>                                                        // O_CREAT, O_RDWR, O_RDONLY
+  #include <sys/mman.h>                                                     // shm_open(), shm_unlink(), mmap(), munmap()
+  #include <sys/stat.h>                                                     // fstat()
+  #include <unistd.h>                                                       // ftruncate(), close(), unlink()
+#endif
+
+
+#include "GroceryItem.hpp"
+#include "GroceryList.hpp"
+#include "SharedGroceryList.hpp"
+
+
+
+
+
+
+
+
+
+
+
+/*******************************************************************************
+**  Implementation of non-member private types, objects, and functions
+*******************************************************************************/
+namespace    // unnamed, anonymous namespace
+{
+  constexpr std::uint64_t MAGIC          = 0x314C5247'4D48534FULL;          // "OSHMGRL1" read little endian
+  constexpr std::uint32_t LAYOUT_VERSION = 1;
+
+
+
+  [[noreturn]] void throwSystemError( std::string_view what, std::string const & name )
+  {
+    auto error = errno;                                                     // capture before anything else can change it
+    throw std::system_error( error, std::generic_category(), std::format( "SharedGroceryList failed to {} \"{}\"", what, name ) );
+  }
+
+
+
+  #if __has_include( <sys/mman.h> )
+    // Closes a file descriptor on scope exit.  The mapping, once made, outlives the descriptor.
+    struct FileDescriptor
+    {
+      int fd = -1;
+     ~FileDescriptor() { if( fd >= 0 )   ::close( fd ); }
+    };
+  #endif
+}    // unnamed, anonymous namespace
+
+
+
+
+
+
+
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Constructors and Destructors
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// create()
+SharedGroceryList SharedGroceryList::create( std::string const & name, std::size_t segmentSize, Backing backing )
+{
+  #if __has_include( <sys/mman.h> )
+    if( segmentSize < sizeof( Header ) )   throw GroceryList::CapacityExceeded_Ex( std::format( "Segment size {} is too small to hold the {} byte header", segmentSize, sizeof( Header ) ) );
+
+    FileDescriptor file{ backing == Backing::SHARED_MEMORY ? ::shm_open( name.c_str(), O_CREAT | O_RDWR, 0600 )
+                                                           : ::open    ( name.c_str(), O_CREAT | O_RDWR, 0600 ) };
+    if( file.fd < 0 )                        throwSystemError( "create", name );
+
+    struct stat status{};
+    if( ::fstat( file.fd, &status ) != 0 )   throwSystemError( "inspect", name );
+
+    // Readers may still have an existing segment mapped, so it is never resized:  shrinking it under them would fault their next
+    // read past the new end.  Only a new, empty object is sized here.  Changing an existing segment's size means unlink() first.
+    auto existingSize = static_cast<std::size_t>( status.st_size );
+    if( existingSize == 0 )
+    {
+      if( ::ftruncate( file.fd, static_cast<off_t>( segmentSize ) ) != 0 )   throwSystemError( "size", name );
+    }
+    else if( existingSize != segmentSize )
+    {
+      throw GroceryList::InvalidInternalState_Ex( std::format( "\"{}\" already exists with a different size ({} bytes, not {}), unlink it first", name, existingSize, segmentSize ) );
+    }
+
+    auto address = ::mmap( nullptr, segmentSize, PROT_READ | PROT_WRITE, MAP_SHARED, file.fd, 0 );
+    if( address == MAP_FAILED )              throwSystemError( "map", name );
+
+    SharedGroceryList sharedList( static_cast<std::byte *>( address ), segmentSize, true );
+
+    // Reusing a segment keeps its sequence counting upward, so readers still mapping it see the change.  Only a segment without a
+    // header, which no reader can have opened, gets a fresh one.  It is constructed in place, its magic number written last so a
+    // reader opening it early sees no header at all.  A live segment of another layout is never rebuilt under its readers.
+    auto & header = sharedList.header();
+    if( header.magic == MAGIC )
+    {
+      std::atomic_thread_fence( std::memory_order_acquire );               // pairs with the fence below, the rest of the header is now visible
+      if( header.layoutVersion != LAYOUT_VERSION
+       || header.recordSize    != sizeof( Record )
+       || header.segmentSize   != segmentSize )   throw GroceryList::InvalidInternalState_Ex( std::format( "\"{}\" already exists with an incompatible layout, unlink it first", name ) );
+    }
+    else if( header.magic == 0 )
+    {
+      auto fresh = ::new( address ) Header{};
+      fresh->layoutVersion = LAYOUT_VERSION;
+      fresh->recordSize    = sizeof( Record );
+      fresh->segmentSize   = segmentSize;
+      std::atomic_thread_fence( std::memory_order_release );
+      fresh->magic         = MAGIC;
+    }
+    else
+    {
+      throw GroceryList::InvalidInternalState_Ex( std::format( "\"{}\" already exists and is not a shared grocery list", name ) );
+    }
+    return sharedList;
+
+  #else
+    (void) name;  (void) segmentSize;  (void) backing;
+    throw std::system_error( std::make_error_code( std::errc::function_not_supported ), "SharedGroceryList requires POSIX shared memory" );
+  #endif
+}
+
+
+
+// open()
+SharedGroceryList SharedGroceryList::open( std::string const & name, Backing backing )
+{
+  #if __has_include( <sys/mman.h> )
+    FileDescriptor file{ backing == Backing::SHARED_MEMORY ? ::shm_open( name.c_str(), O_RDONLY, 0 )
+                                                           : ::open    ( name.c_str(), O_RDONLY    ) };
+    if( file.fd < 0 )   throwSystemError( "open", name );
+
+    struct stat status{};
+    if( ::fstat( file.fd, &status ) != 0 )   throwSystemError( "inspect", name );
+
+    auto size = static_cast<std::size_t>( status.st_size );
+    if( size < sizeof( Header ) )   throw GroceryList::InvalidInternalState_Ex( std::format( "\"{}\" is too small ({} bytes) to be a shared grocery list", name, size ) );
+
+    auto address = ::mmap( nullptr, size, PROT_READ, MAP_SHARED, file.fd, 0 );
+    if( address == MAP_FAILED )   throwSystemError( "map", name );
+
+    SharedGroceryList sharedList( static_cast<std::byte *>( address ), size, false );
+
+    auto & header = sharedList.header();
+    if( header.magic != MAGIC )                     throw GroceryList::InvalidInternalState_Ex( std::format( "\"{}\" is not a shared grocery list", name ) );
+    std::atomic_thread_fence( std::memory_order_acquire );                 // pairs with create()'s fence, the rest of the header is now visible
+    if( header.layoutVersion != LAYOUT_VERSION
+     || header.recordSize    != sizeof( Record )
+     || header.segmentSize   != size )              throw GroceryList::InvalidInternalState_Ex( std::format( "\"{}\" has an incompatible layout", name ) );
+
+    return sharedList;
+
+  #else
+    (void) name;  (void) backing;
+    throw std::system_error( std::make_error_code( std::errc::function_not_supported ), "SharedGroceryList requires POSIX shared memory" );
+  #endif
+}
+
+
+
+// unlink()
+void SharedGroceryList::unlink( std::string const & name, Backing backing )
+{
+  #if __has_include( <sys/mman.h> )
+    auto status = backing == Backing::SHARED_MEMORY ? ::shm_unlink( name.c_str() ) : ::unlink( name.c_str() );
+    if( status != 0 && errno != ENOENT )   throwSystemError( "unlink", name );
+  #else
+    (void) name;  (void) backing;
+  #endif
+}
+
+
+
+// Mapping Constructor
+SharedGroceryList::SharedGroceryList( std::byte * base, std::size_t size, bool writable ) noexcept
+  : _base( base ), _size( size ), _writable( writable )
+{}
+
+
+
+// Move Constructor
+SharedGroceryList::SharedGroceryList( SharedGroceryList && other ) noexcept
+  : _base    ( std::exchange( other._base,     nullptr ) ),
+    _size    ( std::exchange( other._size,     0       ) ),
+    _writable( std::exchange( other._writable, false   ) )
+{}
+
+
+
+// Move Assignment Operator
+SharedGroceryList & SharedGroceryList::operator=( SharedGroceryList && rhs ) noexcept
+{
+  if( this != &rhs )
+  {
+    SharedGroceryList discarded( std::move( *this ) );                      // unmaps this side's segment on the way out
+    _base     = std::exchange( rhs._base,     nullptr );
+    _size     = std::exchange( rhs._size,     0       );
+    _writable = std::exchange( rhs._writable, false   );
+  }
+  return *this;
+}
+
+
+
+// Destructor
+SharedGroceryList::~SharedGroceryList() noexcept
+{
+  #if __has_include( <sys/mman.h> )
+    if( _base != nullptr )   ::munmap( _base, _size );
+  #endif
+  _base = nullptr;
+}
+
+
+
+
+
+
+
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Queries
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// version() const
+std::uint64_t SharedGroceryList::version() const noexcept
+{
+  return header().sequence.load( std::memory_order_acquire );
+}
+
+
+
+// segmentSize() const
+std::size_t SharedGroceryList::segmentSize() const noexcept
+{
+  return _size;
+}
+
+
+
+
+
+
+
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Accessors
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// toGroceryList() const
+GroceryList SharedGroceryList::toGroceryList() const
+{
+  // Copy out under the sequence lock, but build the grocery list afterwards so a retried read doesn't redo the insertions
+  auto groceryItems = read( []( View const & view )
+  {
+    std::vector<GroceryItem> copies;
+    copies.reserve( view.size() );
+    for( auto && item : view )   copies.emplace_back( std::string( item.productName ), std::string( item.brandName ), std::string( item.upcCode ), item.price );
+    return copies;
+  } );
+
+  GroceryList groceryList;
+  for( auto & groceryItem : groceryItems )   groceryList.insert( std::move( groceryItem ), GroceryList::Position::BOTTOM );
+  return groceryList;
+}
+
+
+
+
+
+
+
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Modifiers
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// publish()
+void SharedGroceryList::publish( GroceryList const & groceryList )
+{
+  if( !_writable )   throw std::system_error( std::make_error_code( std::errc::permission_denied ), "SharedGroceryList opened read only cannot publish" );
+
+  // Size everything up front so a grocery list that doesn't fit is rejected before readers are disturbed
+  auto        count       = groceryList.size();
+  auto        recordBytes = count * sizeof( Record );
+  std::size_t stringBytes = 0;
+  for( auto && groceryItem : groceryList )
+  {
+    for( auto && field : { std::string_view( groceryItem.upcCode() ), std::string_view( groceryItem.brandName() ), std::string_view( groceryItem.productName() ) } )
+    {
+      if( field.size() > std::numeric_limits<std::uint32_t>::max() )   throw GroceryList::CapacityExceeded_Ex( "Grocery item text too long for a shared grocery list record" );
+      stringBytes += field.size();
+    }
+  }
+
+  auto required = sizeof( Header ) + recordBytes + stringBytes;
+  if( required > _size )   throw GroceryList::CapacityExceeded_Ex( std::format( "Capacity Exceeded, segment size: {}, required: {}", _size, required ) );
+
+
+  // Open the write window:  an odd sequence tells readers to back off, and the fence keeps the writes below from moving above it
+  auto & header   = this->header();
+  auto   sequence = header.sequence.load( std::memory_order_relaxed );
+  header.sequence.store( sequence + 1, std::memory_order_relaxed );
+  std::atomic_thread_fence( std::memory_order_release );
+
+  auto records    = reinterpret_cast<Record *>( _base + sizeof( Header ) );
+  auto nextString = sizeof( Header ) + recordBytes;
+  auto place      = [&]( std::string const & text, std::uint64_t & offset, std::uint32_t & length )
+  {
+    std::memcpy( _base + nextString, text.data(), text.size() );
+    offset      = nextString;
+    length      = static_cast<std::uint32_t>( text.size() );
+    nextString += text.size();
+  };
+
+  for( auto && groceryItem : groceryList )
+  {
+    Record record{};
+    place( groceryItem.upcCode(),     record.upcOffset,     record.upcLength     );
+    place( groceryItem.brandName(),   record.brandOffset,   record.brandLength   );
+    place( groceryItem.productName(), record.productOffset, record.productLength );
+    record.price = groceryItem.price();
+    std::memcpy( records++, &record, sizeof( record ) );
+  }
+  header.itemCount.store( count, std::memory_order_relaxed );
+
+  // Close the write window, publishing everything above to readers who then observe the new even sequence
+  header.sequence.store( sequence + 2, std::memory_order_release );
+}
+
+
+
+
+
+
+
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private member functions
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// header()
+SharedGroceryList::Header & SharedGroceryList::header() noexcept
+{
+  return *reinterpret_cast<Header *>( _base );
+}
+
+
+
+// header() const
+SharedGroceryList::Header const & SharedGroceryList::header() const noexcept
+{
+  return *reinterpret_cast<Header const *>( _base );
+}
+
+
+
+// recordCapacity() const
+std::size_t SharedGroceryList::recordCapacity() const noexcept
+{
+  return ( _size - sizeof( Header ) ) / sizeof( Record );
+}
+
+
+
+
+
+
+
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// View
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// View Constructor
+SharedGroceryList::View::View( std::byte const * base, std::size_t segmentSize, std::size_t count ) noexcept
+  : _base( base ), _segmentSize( segmentSize ), _count( count )
+{}
+
+
+
+// size() const
+std::size_t SharedGroceryList::View::size() const noexcept
+{
+  return _count;
+}
+
+
+
+// operator[]() const
+SharedGroceryList::Item SharedGroceryList::View::operator[]( std::size_t offsetFromTop ) const noexcept
+{
+  Record record;
+  std::memcpy( &record, _base + sizeof( Header ) + offsetFromTop * sizeof( Record ), sizeof( record ) );
+
+  return { text( record.upcOffset,     record.upcLength     ),
+           text( record.brandOffset,   record.brandLength   ),
+           text( record.productOffset, record.productLength ),
+           record.price };
+}
+
+
+
+// begin() const
+SharedGroceryList::View::const_iterator SharedGroceryList::View::begin() const noexcept
+{
+  return { this, 0 };
+}
+
+
+
+// end() const
+SharedGroceryList::View::const_iterator SharedGroceryList::View::end() const noexcept
+{
+  return { this, _count };
+}
+
+
+
+// text() const
+std::string_view SharedGroceryList::View::text( std::uint64_t offset, std::uint32_t length ) const noexcept
+{
+  // A record read mid publication may hold anything, so never trust it to stay inside the segment
+  if( offset > _segmentSize || length > _segmentSize - offset )   return {};
+  return { reinterpret_cast<char const *>( _base + offset ), length };
+}
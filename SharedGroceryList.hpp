@@ -0,0 +1,198 @@
+#pragma once                                                                                      // include guard
+
+#include <algorithm>                                                                              // min()
+#include <atomic>                                                                                 // atomic, atomic_thread_fence()
+#include <cstddef>                                                                                // size_t, ptrdiff_t, byte
+#include <cstdint>                                                                                // uint32_t, uint64_t
+#include <iterator>                                                                               // forward_iterator_tag
+#include <string>                                                                                 // string
+#include <string_view>                                                                            // string_view
+#include <thread>                                                                                 // this_thread::yield()
+#include <type_traits>                                                                            // is_void_v, invoke_result_t
+#include <utility>                                                                                // as_const()
+
+#include "GroceryItem.hpp"
+#include "GroceryList.hpp"
+
+
+// A SharedGroceryList is a read-mostly grocery list laid out in a POSIX shared memory object or a memory mapped file, so every
+// process on a host can read the same copy in place instead of each parsing its own.  The segment holds a fixed header, a table of
+// fixed size records, and a pool of string bytes.  Records locate their strings by offset from the start of the segment, never by
+// pointer, so the segment means the same thing wherever each process happens to map it.
+//
+// One writer process publishes whole grocery lists; any number of reader processes visit them.  Publication is guarded by a
+// sequence lock:  the writer makes the sequence odd, rewrites the segment, then makes it even again.  A reader notes the (even)
+// sequence, visits the grocery items in place, and tries again if the sequence moved in the meantime.  Readers never block the
+// writer, and never copy unless they choose to.  Only one process may publish at a time; nothing here enforces that.
+class SharedGroceryList
+{
+  public:
+    // Types
+    enum class Backing {SHARED_MEMORY, FILE};                                                     // shm_open() name (starting with '/') or file system path
+
+    struct Item                                                                                   // a grocery item viewed in place, valid only within read()'s visitor
+    {
+      std::string_view upcCode;
+      std::string_view brandName;
+      std::string_view productName;
+      double           price = 0.0;
+    };
+
+    class View;                                                                                   // the published grocery items, as passed to read()'s visitor
+
+    static constexpr std::size_t DEFAULT_SEGMENT_SIZE = 1024 * 1024;
+
+
+    // Constructors, destructor, and assignments
+    //
+    // Mappings are owned, so shared lists can be moved but not copied.  Open the same name again to get a second mapping.
+    static SharedGroceryList create( std::string const & name, std::size_t segmentSize = DEFAULT_SEGMENT_SIZE, Backing backing = Backing::SHARED_MEMORY );   // creates a segment, or reuses one of the same size and layout, and maps it for writing
+    static SharedGroceryList open  ( std::string const & name,                                                 Backing backing = Backing::SHARED_MEMORY );   // maps an existing segment read only
+    static void              unlink( std::string const & name,                                                 Backing backing = Backing::SHARED_MEMORY );   // removes the name, existing mappings remain valid
+
+    SharedGroceryList            ( SharedGroceryList && other ) noexcept;
+    SharedGroceryList & operator=( SharedGroceryList && rhs   ) noexcept;
+   ~SharedGroceryList() noexcept;
+
+
+    // Queries
+    std::uint64_t version    () const noexcept;                                                   // number of completed publications, odd while one is in progress
+    std::size_t   segmentSize() const noexcept;
+
+
+    // Accessors
+    template<typename Visitor>
+    decltype( auto ) read( Visitor && visitor ) const;                                            // calls visitor( View const & ) until it sees a consistent publication, returns its result
+
+    GroceryList toGroceryList() const;                                                            // copies the current publication out of the segment
+
+
+    // Modifiers
+    void publish( GroceryList const & groceryList );                                              // writer only, throws CapacityExceeded_Ex if the grocery list won't fit
+
+
+  private:
+    // Types
+    struct Record                                                                                 // one grocery item, strings located by offset from the segment's start
+    {
+      std::uint64_t upcOffset,  brandOffset,  productOffset;
+      std::uint32_t upcLength,  brandLength,  productLength;
+      std::uint32_t reserved = 0;
+      double        price;
+    };
+
+    struct alignas( 64 ) Header                                                                   // at offset 0, on its own cache line
+    {
+      std::uint64_t              magic;
+      std::uint32_t              layoutVersion;
+      std::uint32_t              recordSize;
+      std::uint64_t              segmentSize;
+      std::atomic<std::uint64_t> sequence;                                                        // the sequence lock, odd while the writer is publishing
+      std::atomic<std::uint64_t> itemCount;                                                       // records follow the header, strings follow the records
+    };
+
+    static_assert( std::atomic<std::uint64_t>::is_always_lock_free, "sequence lock must be address free to work across processes" );
+
+    // Helper member functions
+    SharedGroceryList( std::byte * base, std::size_t size, bool writable ) noexcept;
+
+    Header       & header()       noexcept;
+    Header const & header() const noexcept;
+    std::size_t    recordCapacity() const noexcept;                                               // the most records that fit if every string were empty
+
+    // Instance Attributes
+    std::byte * _base     = nullptr;                                                              // start of the mapping
+    std::size_t _size     = 0;                                                                    // length of the mapping
+    bool        _writable = false;
+};
+
+
+
+// The published grocery items, viewed in place.  A view is only meaningful for the duration of the read() visitor it was passed to.
+// It may also be observed mid publication (read() then discards the visitor's result and tries again), so every offset is bounds
+// checked and a torn record yields empty strings rather than a stray read.
+class SharedGroceryList::View
+{
+  public:
+    class const_iterator;
+
+    std::size_t size      (                        ) const noexcept;
+    Item        operator[]( std::size_t offsetFromTop ) const noexcept;                           // unchecked offset, checked string bounds
+
+    const_iterator begin() const noexcept;
+    const_iterator end  () const noexcept;
+
+  private:
+    friend class SharedGroceryList;
+
+    View( std::byte const * base, std::size_t segmentSize, std::size_t count ) noexcept;
+
+    std::string_view text( std::uint64_t offset, std::uint32_t length ) const noexcept;
+
+    std::byte const * _base        = nullptr;
+    std::size_t       _segmentSize = 0;
+    std::size_t       _count       = 0;
+};
+
+
+
+class SharedGroceryList::View::const_iterator
+{
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type        = Item;
+    using difference_type   = std::ptrdiff_t;
+
+    const_iterator() = default;
+    const_iterator( View const * view, std::size_t offsetFromTop ) noexcept : _view( view ), _offsetFromTop( offsetFromTop ) {}
+
+    Item             operator* (     ) const noexcept { return ( *_view )[_offsetFromTop]; }
+    const_iterator & operator++(     )       noexcept { ++_offsetFromTop;  return *this;    }
+    const_iterator   operator++( int )       noexcept { auto previous = *this;  ++*this;  return previous; }
+
+    bool operator==( const_iterator const & rhs ) const noexcept { return _offsetFromTop == rhs._offsetFromTop; }
+
+  private:
+    View const * _view          = nullptr;
+    std::size_t  _offsetFromTop = 0;
+};
+
+
+
+
+
+
+
+
+/*******************************************************************************
+**  Template definitions
+*******************************************************************************/
+
+// read() const
+template<typename Visitor>
+decltype( auto ) SharedGroceryList::read( Visitor && visitor ) const
+{
+  // The visitor's reads of the records and strings race with a concurrent publication by design.  They're validated after the fact:
+  // if the sequence is unchanged (and wasn't odd to begin with) nothing was written while the visitor looked, so its result stands.
+  auto & sequence = header().sequence;
+  while( true )
+  {
+    auto before = sequence.load( std::memory_order_acquire );
+    if( before % 2 != 0 ) { std::this_thread::yield();  continue; }             // a publication is in progress
+
+    View view( _base, _size, std::min<std::size_t>( header().itemCount.load( std::memory_order_relaxed ), recordCapacity() ) );
+
+    if constexpr( std::is_void_v<std::invoke_result_t<Visitor &, View const &>> )
+    {
+      visitor( std::as_const( view ) );
+      std::atomic_thread_fence( std::memory_order_acquire );
+      if( sequence.load( std::memory_order_relaxed ) == before )   return;
+    }
+    else
+    {
+      auto result = visitor( std::as_const( view ) );
+      std::atomic_thread_fence( std::memory_order_acquire );
+      if( sequence.load( std::memory_order_relaxed ) == before )   return result;
+    }
+  }
+}
@@ -0,0 +1,103 @@
+#pragma once                                                                                      // include guard
+
+#include <compare>                                                                                // strong_ordering
+#include <cstddef>                                                                                // size_t
+#include <cstdint>                                                                                // uint32_t
+#include <stdexcept>                                                                              // length_error, out_of_range
+#include <utility>                                                                                // forward(), move()
+#include <vector>
+
+
+// A Slab stores each element exactly once in stable slots and hands out compact 32-bit generational handles to them.  A handle packs
+// a 24-bit slot index with an 8-bit generation that is bumped every time the slot is released, so a handle to a released (and
+// possibly reused) slot is detected as stale rather than silently aliasing the new occupant.
+//
+// Handles are plain integers:  copying, comparing, and hashing them never touches the elements themselves.
+template<typename T>
+class Slab
+{
+  public:
+    // Types
+    struct Handle
+    {
+      std::uint32_t value = 0;
+
+      constexpr std::uint32_t index     () const noexcept { return value & INDEX_MASK; }
+      constexpr std::uint32_t generation() const noexcept { return value >> INDEX_BITS; }
+
+      constexpr auto operator<=>( Handle const & ) const noexcept = default;
+    };
+
+    static constexpr std::uint32_t INDEX_BITS = 24;
+    static constexpr std::uint32_t INDEX_MASK = ( std::uint32_t{ 1 } << INDEX_BITS ) - 1;
+    static constexpr std::size_t   MAX_SLOTS  = INDEX_MASK + std::size_t{ 1 };
+
+
+    // Queries
+    std::size_t size    (                      ) const noexcept { return _slots.size() - _free.size(); }   // number of occupied slots
+    bool        contains( Handle const handle  ) const noexcept
+    {
+      return handle.index() < _slots.size()  &&  _slots[handle.index()].occupied  &&  _slots[handle.index()].generation == handle.generation();
+    }
+
+
+    // Accessors
+    T const & operator[]( Handle const handle ) const noexcept { return _slots[handle.index()].element; }   // unchecked, see at()
+    T       & operator[]( Handle const handle )       noexcept { return _slots[handle.index()].element; }
+
+    T const & at( Handle const handle ) const
+    {
+      if( !contains( handle ) )   throw std::out_of_range( "Stale or invalid slab handle" );
+      return ( *this )[handle];
+    }
+
+
+    // Modifiers
+    template<typename... Args>
+    Handle emplace( Args &&... args )                                                             // constructs an element in a free slot
+    {
+      std::uint32_t index;
+      if( _free.empty() )
+      {
+        if( _slots.size() >= MAX_SLOTS )   throw std::length_error( "Slab handle space exhausted" );
+        _slots.push_back( Slot{ T( std::forward<Args>( args )... ) } );
+        index = static_cast<std::uint32_t>( _slots.size() - 1 );
+      }
+      else
+      {
+        index = _free.back();
+        _slots[index].element = T( std::forward<Args>( args )... );
+        _free.pop_back();
+      }
+
+      auto & slot    = _slots[index];
+      slot.occupied  = true;
+      return Handle{ ( std::uint32_t{ slot.generation } << INDEX_BITS ) | index };
+    }
+
+    void release( Handle const handle )                                                           // no change occurs if the handle is stale
+    {
+      if( !contains( handle ) )   return;
+
+      _free.reserve( _slots.size() );                                                             // so the push_back below cannot throw after the slot is vacated
+      auto & slot    = _slots[handle.index()];
+      slot.element   = T{};                                                                       // release the element's resources now
+      slot.occupied  = false;
+      ++slot.generation;                                                                          // wraps at 256, plenty to catch the common use-after-release
+      _free.push_back( handle.index() );
+    }
+
+
+  private:
+    // Types
+    struct Slot
+    {
+      T             element;
+      std::uint8_t  generation = 0;
+      bool          occupied   = false;
+    };
+
+    // Instance Attributes
+    std::vector<Slot>          _slots;
+    std::vector<std::uint32_t> _free;                                                             // indices of vacant slots, reused last in first out
+};
@@ -0,0 +1,360 @@
+#include <algorithm>                                                        // find_if(), move_backward(), move(), min()
+#include <compare>                                                          // weak_ordering
+#include <cstddef>                                                          // size_t
+#include <format>                                                           // format()
+#include <initializer_list>                                                 // initializer_list
+#include <iomanip>                                                          // setw()
+#include <iostream>                                                         // istream, ostream
+#include <iterator>                                                         // distance(), next()
+
+#include "GroceryItem.hpp"
+#include "SlabGroceryList.hpp"
+
+
+
+
+
+
+
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Constructors and Destructors
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Initializer List Constructor
+SlabGroceryList::SlabGroceryList( std::initializer_list<GroceryItem> const & initList )
+{
+  for( auto && groceryItem : initList )   insert( groceryItem, Position::BOTTOM );
+
+  // Verify the internal grocery list state is still consistent amongst the four containers
+  if( !containersAreConsistant() )   throw InvalidInternalState_Ex( "Container consistency error" );
+}
+
+
+
+
+
+
+
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Queries
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// size() const
+std::size_t SlabGroceryList::size() const
+{
+  // Verify the internal grocery list state is still consistent amongst the four containers
+  if( !containersAreConsistant() )   throw InvalidInternalState_Ex( "Container consistency error" );
+
+  return _gList_vector.size();
+}
+
+
+
+
+
+
+
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Accessors
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// find() const
+std::size_t SlabGroceryList::find( GroceryItem const & groceryItem ) const
+{
+  // Verify the internal grocery list state is still consistent amongst the four containers
+  if( !containersAreConsistant() )   throw InvalidInternalState_Ex( "Container consistency error" );
+
+  auto match = std::find_if( _gList_vector.begin(), _gList_vector.end(), [&]( Handle handle ) { return _items[handle] == groceryItem; } );
+  return static_cast<std::size_t>( match - _gList_vector.begin() );       // if not found, index == size()
+}
+
+
+
+// at() const
+GroceryItem const & SlabGroceryList::at( std::size_t offsetFromTop ) const
+{
+  if( offsetFromTop >= size() )   throw InvalidOffset_Ex( std::format( "Access position beyond end of current list size\n  position:     {:>2}\n  current size: {:>2}", offsetFromTop, size() ) );
+  return _items[ _gList_vector[offsetFromTop] ];
+}
+
+
+
+
+
+
+
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Modifiers
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// insert( position )
+void SlabGroceryList::insert( GroceryItem const & groceryItem, Position position )
+{
+  if( position == Position::TOP )   insert( groceryItem, 0      );
+  else                              insert( groceryItem, size() );
+}
+
+
+
+// insert( offset )
+void SlabGroceryList::insert( GroceryItem const & groceryItem, std::size_t offsetFromTop )
+{
+  if( offsetFromTop > size() )   throw InvalidOffset_Ex( std::format( "Insertion position beyond end of current list size\n  position:     {:>2}\n  current size: {:>2}", offsetFromTop, size() ) );
+
+  // Prevent duplicate entries
+  if( find( groceryItem ) != size() )   return;
+
+  // Check capacity before the grocery item is stored so a rejected insertion leaves the slab untouched
+  if( _gList_array_size >= _gList_array.size() )   throw CapacityExceeded_Ex( std::format( "Capacity Exceeded, array capacity: {}, list size: {}", _gList_array.size(), _gList_array_size ) );
+
+  // The one and only copy of the grocery item, all four containers share its handle
+  insertHandle( _items.emplace( groceryItem ), offsetFromTop );
+
+  // Verify the internal grocery list state is still consistent amongst the four containers
+  if( !containersAreConsistant() )   throw InvalidInternalState_Ex( "Container consistency error" );
+}
+
+
+
+// remove( groceryItem )
+void SlabGroceryList::remove( GroceryItem const & groceryItem )
+{
+  remove( find( groceryItem ) );
+}
+
+
+
+// remove( offset )
+void SlabGroceryList::remove( std::size_t offsetFromTop )
+{
+  if( offsetFromTop >= size() )   return;
+
+  _items.release( removeHandle( offsetFromTop ) );
+
+  // Verify the internal grocery list state is still consistent amongst the four containers
+  if( !containersAreConsistant() )   throw InvalidInternalState_Ex( "Container consistency error" );
+}
+
+
+
+// moveToTop()
+void SlabGroceryList::moveToTop( GroceryItem const & groceryItem )
+{
+  auto offset = find( groceryItem );
+  if( offset != size() )   insertHandle( removeHandle( offset ), 0 );       // relink the existing handle, the grocery item itself never moves
+
+  // Verify the internal grocery list state is still consistent amongst the four containers
+  if( !containersAreConsistant() )   throw InvalidInternalState_Ex( "Container consistency error" );
+}
+
+
+
+// operator+=( initializer_list )
+SlabGroceryList & SlabGroceryList::operator+=( std::initializer_list<GroceryItem> const & rhs )
+{
+  for( auto && groceryItem : rhs )   insert( groceryItem, Position::BOTTOM );
+  return *this;
+}
+
+
+
+// operator+=( SlabGroceryList )
+SlabGroceryList & SlabGroceryList::operator+=( SlabGroceryList const & rhs )
+{
+  for( auto handle : rhs._gList_vector )   insert( rhs._items[handle], Position::BOTTOM );
+  return *this;
+}
+
+
+
+
+
+
+
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Relational Operators
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// operator<=>
+std::weak_ordering SlabGroceryList::operator<=>( SlabGroceryList const & rhs ) const
+{
+  auto commonSize = std::min( size(), rhs.size() );
+  for( std::size_t i = 0; i < commonSize; ++i )
+  {
+    auto cmp = _items[ _gList_vector[i] ] <=> rhs._items[ rhs._gList_vector[i] ];
+    if( cmp != 0 )   return cmp;
+  }
+  return size() <=> rhs.size();
+}
+
+
+
+// operator==
+bool SlabGroceryList::operator==( SlabGroceryList const & rhs ) const
+{
+  if( size() != rhs.size() )   return false;
+  for( std::size_t i = 0; i < size(); ++i )   if( _items[ _gList_vector[i] ] != rhs._items[ rhs._gList_vector[i] ] )   return false;
+  return true;
+}
+
+
+
+
+
+
+
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private member functions
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// containersAreConsistant() const
+bool SlabGroceryList::containersAreConsistant() const
+{
+  // Sizes of all containers, and the number of stored grocery items, must be equal to each other
+  if(    _gList_array_size != _gList_vector.size()
+      || _gList_array_size != _gList_dll.size()
+      || _gList_array_size !=  gList_sll_size()
+      || _gList_array_size != _items.size()   ) return false;
+
+  // Handle content and order must be equal to each other.  Equal handles refer to the very same grocery item, so comparing the
+  // 32-bit handles is as strong as comparing the grocery items themselves.
+  auto current_array_position   = _gList_array .cbegin();
+  auto current_dll_position     = _gList_dll   .cbegin();
+  auto current_sll_position     = _gList_sll   .cbegin();
+
+  for( auto handle : _gList_vector )
+  {
+    if(    handle != *current_array_position
+        || handle != *current_dll_position
+        || handle != *current_sll_position
+        || !_items.contains( handle )        ) return false;
+
+    // Advance the iterators to the next element in unison
+    ++current_array_position;
+    ++current_dll_position;
+    ++current_sll_position;
+  }
+
+  return true;
+}
+
+
+
+// gList_sll_size() const
+std::size_t SlabGroceryList::gList_sll_size() const
+{
+  return static_cast<std::size_t>( std::distance( _gList_sll.begin(), _gList_sll.end() ) );
+}
+
+
+
+// insertHandle()
+void SlabGroceryList::insertHandle( Handle handle, std::size_t offsetFromTop )
+{
+  // Part 1 - Insert into array
+  std::move_backward( _gList_array.begin() + offsetFromTop, _gList_array.begin() + _gList_array_size, _gList_array.begin() + _gList_array_size + 1 );
+  _gList_array[offsetFromTop] = handle;
+  ++_gList_array_size;
+
+  // Part 2 - Insert into vector
+  _gList_vector.insert( std::next( _gList_vector.begin(), offsetFromTop ), handle );
+
+  // Part 3 - Insert into doubly linked list
+  _gList_dll.insert( std::next( _gList_dll.begin(), offsetFromTop ), handle );
+
+  // Part 4 - Insert into singly linked list
+  _gList_sll.insert_after( std::next( _gList_sll.before_begin(), offsetFromTop ), handle );
+}
+
+
+
+// removeHandle()
+SlabGroceryList::Handle SlabGroceryList::removeHandle( std::size_t offsetFromTop )
+{
+  auto handle = _gList_vector[offsetFromTop];
+
+  // Part 1 - Remove from array
+  std::move( _gList_array.begin() + offsetFromTop + 1, _gList_array.begin() + _gList_array_size, _gList_array.begin() + offsetFromTop );
+  --_gList_array_size;
+
+  // Part 2 - Remove from vector
+  _gList_vector.erase( std::next( _gList_vector.begin(), offsetFromTop ) );
+
+  // Part 3 - Remove from doubly linked list
+  _gList_dll.erase( std::next( _gList_dll.begin(), offsetFromTop ) );
+
+  // Part 4 - Remove from singly linked list
+  _gList_sll.erase_after( std::next( _gList_sll.before_begin(), offsetFromTop ) );
+
+  return handle;
+}
+
+
+
+
+
+
+
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Non-member functions
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// operator<<
+std::ostream & operator<<( std::ostream & stream, SlabGroceryList const & groceryList )
+{
+  if( !groceryList.containersAreConsistant() )   throw SlabGroceryList::InvalidInternalState_Ex( "Container consistency error" );
+
+  // Same layout as GroceryList's insertion operator
+  unsigned count = 0;
+  for( auto handle : groceryList._gList_sll )   stream << '\n' << std::setw(5) << count++ << ":  " << groceryList._items[handle];
+
+  return stream;
+}
+
+
+
+// operator>>
+std::istream & operator>>( std::istream & stream, SlabGroceryList & groceryList )
+{
+  if( !groceryList.containersAreConsistant() )   throw SlabGroceryList::InvalidInternalState_Ex( "Container consistency error" );
+
+  GroceryItem temp;
+  while( stream >> temp )   groceryList.insert( temp, SlabGroceryList::Position::BOTTOM );
+
+  return stream;
+}
@@ -0,0 +1,86 @@
+#pragma once                                                                                      // include guard
+
+#include <array>
+#include <compare>                                                                                // weak_ordering
+#include <cstddef>                                                                                // size_t
+#include <forward_list>
+#include <initializer_list>                                                                       // initializer_list
+#include <iostream>                                                                               // istream, ostream
+#include <list>
+#include <vector>
+
+#include "GroceryItem.hpp"
+#include "GroceryList.hpp"
+#include "Slab.hpp"
+
+
+// A SlabGroceryList keeps GroceryList's four ordering containers (array, vector, doubly and singly linked lists) and their
+// consistency guarantee, but stores each grocery item only once in a slab.  The containers hold 32-bit slab handles, so an insert
+// constructs one GroceryItem instead of copying it four times, and the consistency check compares integers instead of strings.
+class SlabGroceryList
+{
+  // Insertion and Extraction Operators
+  friend std::ostream & operator<<( std::ostream & stream, SlabGroceryList const & groceryList );
+  friend std::istream & operator>>( std::istream & stream, SlabGroceryList       & groceryList );
+
+  public:
+    // Types and Exceptions
+    using Position                = GroceryList::Position;
+    using InvalidInternalState_Ex = GroceryList::InvalidInternalState_Ex;
+    using CapacityExceeded_Ex     = GroceryList::CapacityExceeded_Ex;
+    using InvalidOffset_Ex        = GroceryList::InvalidOffset_Ex;
+    using Handle                  = Slab<GroceryItem>::Handle;
+
+
+    // Constructors, destructor, and assignments
+    //
+    // Handles are plain indices into this list's own slab, so the compiler synthesized copy and move operations work just fine.
+    SlabGroceryList() = default;                                                                  // constructs an empty grocery list
+    SlabGroceryList( std::initializer_list<GroceryItem> const & initList );                       // constructs a grocery list from a braced list of grocery items
+
+
+    // Queries
+    std::size_t size() const;                                                                     // returns the number of grocery items in this grocery list
+
+
+    // Accessors
+    std::size_t         find( GroceryItem const & groceryItem ) const;                            // returns the grocery item's (zero-based) offset from top, size() if grocery item not found
+    GroceryItem const & at  ( std::size_t offsetFromTop       ) const;                            // throws InvalidOffset_Ex if offsetFromTop >= size()
+
+
+    // Modifiers
+    void insert   ( GroceryItem const & groceryItem, Position    position = Position::TOP );      // inserts the grocery item at the top (beginning) or bottom (end) of the grocery list
+    void insert   ( GroceryItem const & groceryItem, std::size_t offsetFromTop            );      // inserts before the existing grocery item currently at that offset
+
+    void remove   ( GroceryItem const & groceryItem                                       );      // no change occurs if grocery item not found
+    void remove   ( std::size_t         offsetFromTop                                     );      // no change occurs if (zero-based) offsetFromTop >= size()
+
+    void moveToTop( GroceryItem const & groceryItem                                       );      // moves the existing handle, no grocery item is copied
+
+    SlabGroceryList & operator+=( std::initializer_list<GroceryItem> const & rhs );
+    SlabGroceryList & operator+=( SlabGroceryList                    const & rhs );
+
+
+    // Relational Operators
+    std::weak_ordering operator<=>( SlabGroceryList const & rhs ) const;
+    bool               operator== ( SlabGroceryList const & rhs ) const;
+
+
+  private:
+    // Instance Attributes
+    Slab<GroceryItem>                                 _items;                                     // each grocery item stored exactly once
+
+    std::array       <Handle, GroceryList::CAPACITY>  _gList_array;                               // underlying containers holding handles to grocery items
+    std::vector      <Handle                       >  _gList_vector;                              // operations performed on once container must be
+    std::list        <Handle                       >  _gList_dll;                                 // replicated across all containers
+    std::forward_list<Handle                       >  _gList_sll;
+
+    std::size_t                                       _gList_array_size = 0;                      // number of valid elements in _gList_array
+
+
+    // Helper member functions
+    bool        containersAreConsistant() const;
+    std::size_t gList_sll_size         () const;
+    void        insertHandle           ( Handle handle, std::size_t offsetFromTop );              // places an existing handle in all four containers
+    Handle      removeHandle           ( std::size_t offsetFromTop );                             // takes a handle out of all four containers without releasing it
+};
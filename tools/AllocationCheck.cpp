@@ -0,0 +1,225 @@
+// Counts the heap allocations each GroceryItem and GroceryList operation makes, and fails if any count differs from what the
+// operation is known to need.  Grocery items pass strings by value and move them into place, and r-value accessors hand their
+// strings over rather than copying them.  A change that quietly adds a copy shows up here as an extra allocation.
+//
+//    usage:  AllocationCheck
+//
+// Build alongside the library's translation units, leaving out main.cpp, with the repository root on the include path.  Exits
+// with a non-zero status if any count is off.  Every string used is too long for the small string optimization, so each string
+// copy costs exactly one allocation.  The expected counts are for libstdc++ and may need adjusting for other standard libraries,
+// whose node and growth strategies differ.
+#include <cstddef>                                                          // size_t
+#include <cstdlib>                                                          // malloc(), free(), EXIT_SUCCESS, EXIT_FAILURE
+#include <exception>                                                        // exception
+#include <format>                                                           // format()
+#include <functional>                                                       // function
+#include <iostream>                                                         // cout, cerr
+#include <new>                                                              // bad_alloc, align_val_t
+#include <sstream>                                                          // istringstream
+#include <string>                                                           // string
+#include <utility>                                                          // move()
+
+#include "GroceryItem.hpp"
+#include "GroceryList.hpp"
+
+
+
+
+/*******************************************************************************
+**  Global allocation hooks
+*******************************************************************************/
+namespace
+{
+  bool        counting    = false;                                          // only allocations made by the operation under test count
+  std::size_t allocations = 0;
+}
+
+
+void * operator new( std::size_t size )
+{
+  if( counting )   ++allocations;
+  if( auto p = std::malloc( size == 0 ? 1 : size ) )   return p;
+  throw std::bad_alloc{};
+}
+
+void * operator new[]( std::size_t size )
+{
+  return ::operator new( size );
+}
+
+void * operator new( std::size_t size, std::align_val_t alignment )
+{
+  if( counting )   ++allocations;
+  auto align = static_cast<std::size_t>( alignment );
+  if( auto p = std::aligned_alloc( align, ( size + align - 1 ) / align * align ) )   return p;
+  throw std::bad_alloc{};
+}
+
+void * operator new[]( std::size_t size, std::align_val_t alignment )
+{
+  return ::operator new( size, alignment );
+}
+
+void operator delete  ( void * p                                   ) noexcept { std::free( p ); }
+void operator delete[]( void * p                                   ) noexcept { std::free( p ); }
+void operator delete  ( void * p, std::size_t                      ) noexcept { std::free( p ); }
+void operator delete[]( void * p, std::size_t                      ) noexcept { std::free( p ); }
+void operator delete  ( void * p, std::align_val_t                 ) noexcept { std::free( p ); }
+void operator delete[]( void * p, std::align_val_t                 ) noexcept { std::free( p ); }
+void operator delete  ( void * p, std::size_t, std::align_val_t    ) noexcept { std::free( p ); }
+void operator delete[]( void * p, std::size_t, std::align_val_t    ) noexcept { std::free( p ); }
+
+
+
+
+namespace
+{
+  // Runs the operation with counting on and reports whether it made exactly the expected number of allocations.  Setup and
+  // teardown (building inputs, destroying results) happen outside the counted region.
+  bool check( std::string const & name, std::size_t expected, std::function<void()> const & operation )
+  {
+    allocations = 0;
+    counting    = true;
+    operation();
+    counting    = false;
+
+    auto passed = allocations == expected;
+    std::cout << std::format( "{:<48}{:>10}{:>10}  {}\n", name, expected, allocations, passed ? "PASS" : "FAIL" );
+    return passed;
+  }
+
+
+
+  // Strings longer than any small string buffer, so every string copy allocates
+  std::string longString( char tag )
+  {
+    return std::string( 40, tag );
+  }
+
+
+
+  GroceryItem longItem( char tag, double price = 1.0 )
+  {
+    return { longString( tag ), longString( tag ), longString( tag ), price };
+  }
+
+
+
+  GroceryList sampleList()
+  {
+    return { longItem( 'a' ), longItem( 'b' ), longItem( 'c' ), longItem( 'd' ), longItem( 'e' ) };
+  }
+}
+
+
+
+
+int main()
+{
+  try
+  {
+    bool passed = true;
+    std::cout << std::format( "{:<48}{:>10}{:>10}\n", "operation", "expected", "actual" );
+
+
+    // GroceryItem
+    {
+      auto upc = longString( 'u' ), brand = longString( 'b' ), product = longString( 'p' );
+      passed &= check( "GroceryItem( moved strings )", 0, [&] { GroceryItem item( std::move( product ), std::move( brand ), std::move( upc ), 1.0 ); } );
+    }
+    {
+      auto upc = longString( 'u' ), brand = longString( 'b' ), product = longString( 'p' );
+      passed &= check( "GroceryItem( copied strings )", 3, [&] { GroceryItem item( product, brand, upc, 1.0 ); } );
+    }
+    {
+      auto source = longItem( 'x' );
+      passed &= check( "GroceryItem copy construction", 3, [&] { GroceryItem item( source ); } );
+      passed &= check( "GroceryItem move construction", 0, [&] { GroceryItem item( std::move( source ) ); } );
+    }
+    {
+      auto source = longItem( 'x' );
+      auto target = longItem( 'y' );
+      passed &= check( "GroceryItem copy assignment (room to spare)", 0, [&] { target = source; } );
+      passed &= check( "GroceryItem move assignment", 0, [&] { target = std::move( source ); } );
+    }
+    {
+      auto source = longItem( 'x' );
+      passed &= check( "GroceryItem r-value accessor", 0, [&] { auto product = std::move( source ).productName(); } );
+    }
+
+
+    // GroceryList
+    //
+    // Inserting an l-value copies the grocery item into each of the four containers (three strings apiece), and allocates a node
+    // for each linked list, price index, and brand index entry, plus whatever the vector and brand table need to grow.  An
+    // r-value is moved into the last container, saving one copy:  each l-value / r-value pair below starts from identical lists
+    // and inserts at the same position, so the pair differs by exactly those three string allocations.  emplace() moves its
+    // by-value strings into the new grocery item, so it costs what an r-value insert does.  Removal only frees.  The sample list
+    // holds five grocery items, each of its own brand, with its vector at capacity.
+    for( auto position : { GroceryList::Position::TOP, GroceryList::Position::BOTTOM } )
+    {
+      auto where = position == GroceryList::Position::TOP ? "TOP" : "BOTTOM";
+      {
+        auto list = sampleList();
+        auto item = longItem( 'z' );
+        passed &= check( std::format( "insert( l-value, {} )", where ), 18, [&] { list.insert( item, position ); } );
+      }
+      {
+        auto list = sampleList();
+        auto item = longItem( 'z' );
+        passed &= check( std::format( "insert( r-value, {} )", where ), 15, [&] { list.insert( std::move( item ), position ); } );
+      }
+      {
+        auto list = sampleList();
+        auto upc = longString( 'z' ), brand = longString( 'z' ), product = longString( 'z' );
+        passed &= check( std::format( "emplace( {}, moved strings )", where ), 15,
+                         [&] { list.emplace( position, std::move( product ), std::move( brand ), std::move( upc ), 1.0 ); } );
+      }
+    }
+    {
+      auto list = sampleList();
+      auto upc = longString( 'z' ), brand = longString( 'z' ), product = longString( 'z' );
+      passed &= check( "emplace( offset, moved strings )", 15, [&] { list.emplace( 2, std::move( product ), std::move( brand ), std::move( upc ), 1.0 ); } );
+    }
+    {
+      auto list = sampleList();
+      auto item = longItem( 'c' );
+      passed &= check( "remove( grocery item )", 0, [&] { list.remove( item ); } );
+    }
+    {
+      auto list = sampleList();
+      passed &= check( "remove( offset )", 0, [&] { list.remove( 2 ); } );
+    }
+    {
+      auto list = sampleList();
+      auto item = longItem( 'd' );
+      passed &= check( "moveToTop()", 15, [&] { list.moveToTop( item ); } );
+    }
+    {
+      auto list  = sampleList();
+      auto other = GroceryList{ longItem( 'x' ), longItem( 'y' ) };
+      passed &= check( "operator+=( GroceryList )",      36, [&] { list += other; } );
+    }
+    {
+      auto list  = sampleList();
+      auto items = { longItem( 'x' ), longItem( 'y' ) };
+      passed &= check( "operator+=( initializer_list )", 36, [&] { list += items; } );
+    }
+    {
+      GroceryList        list;
+      std::istringstream stream( std::format( R"("{0}", "{0}", "{1}", 1.0  "{0}", "{0}", "{2}", 2.0)", longString( 'u' ), longString( 'p' ), longString( 'q' ) ) );
+      passed &= check( "operator>>( two grocery items )", 51, [&] { stream >> list; } );
+    }
+
+
+    std::cout << ( passed ? "\nAll allocation counts as expected\n" : "\nAllocation counts changed\n" );
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+  }
+
+  catch( std::exception const & ex )
+  {
+    counting = false;
+    std::cerr << "Fatal Error:  " << ex.what() << '\n';
+    return EXIT_FAILURE;
+  }
+}
@@ -0,0 +1,477 @@
+// Drives grocery lists with a realistic mix of operations from several threads at once, and reports throughput and tail latency for
+// each kind of operation.
+//
+//    usage:  LoadGenerator [--threads=N] [--operations=N] [--mix=find:40,insert:25,moveToTop:20,merge:10,load:5]
+//                          [--products=N] [--brands=N] [--product-skew=S] [--brand-skew=S] [--list-size=N] [--seed=N]
+//                          [--trace=file] [--record=file]
+//
+// Build alongside the library's translation units, leaving out main.cpp, with the repository root on the include path.
+//
+// A GroceryList isn't safe to share between threads, so each thread drives a list of its own, starting with list-size grocery
+// items.  Inserts, merges, and loads first drop grocery items from the bottom to stay within list-size; only the operation itself is
+// timed.  Synthetic traffic draws products and brands from Zipf distributions, so a few products are hot and a few brands account
+// for most grocery items, as in real catalogs.  Each thread draws its own synthetic trace.  --record writes the first thread's
+// trace to a file, and --trace replays a recorded trace on every thread instead.
+//
+// A trace holds one operation per line:  its name, how many grocery items it carries, then the grocery items in GroceryItem's text
+// format.  Finds, inserts, and moveToTops carry one grocery item, merges and loads carry a batch.
+//
+//    moveToTop 1 "000000420007", "brand 0007", "product 00042", 4.70
+//    merge 2 "000000130002", "brand 0002", "product 00013", 1.63 "000000050000", "brand 0000", "product 00005", 0.55
+#include <algorithm>                                                        // min(), sort(), upper_bound()
+#include <array>                                                            // array
+#include <chrono>                                                           // steady_clock, duration
+#include <cmath>                                                            // ceil(), pow()
+#include <cstddef>                                                          // size_t
+#include <cstdint>                                                          // int64_t
+#include <exception>                                                        // exception, exception_ptr, current_exception(), rethrow_exception()
+#include <format>                                                           // format()
+#include <fstream>                                                          // ifstream, ofstream
+#include <iostream>                                                         // cout, cerr, istream, ostream
+#include <latch>                                                            // latch
+#include <random>                                                           // mt19937_64, uniform_real_distribution
+#include <sstream>                                                          // istringstream, ostringstream
+#include <stdexcept>                                                        // invalid_argument, runtime_error
+#include <string>                                                           // string, stoull(), stod()
+#include <string_view>                                                      // string_view
+#include <thread>                                                           // jthread, hardware_concurrency()
+#include <utility>                                                          // move()
+#include <vector>                                                           // vector
+
+#include "GroceryItem.hpp"
+#include "GroceryList.hpp"
+
+
+
+
+namespace
+{
+  /*******************************************************************************
+  **  Operations and traces
+  *******************************************************************************/
+  enum class Kind : std::size_t { FIND, INSERT, MOVE_TO_TOP, MERGE, LOAD };
+
+  constexpr std::size_t                              KIND_COUNT = 5;
+  constexpr std::array<std::string_view, KIND_COUNT> KIND_NAMES = { "find", "insert", "moveToTop", "merge", "load" };
+  constexpr std::size_t                              MAX_BATCH  = 3;        // most grocery items carried by a merge or load
+
+
+
+  struct Operation
+  {
+    Kind                     kind = Kind::FIND;
+    std::vector<GroceryItem> groceryItems;
+    GroceryList              batch;                                         // merges:  the grocery items as a list, built before the clock starts
+    std::string              text;                                          // loads:   the grocery items as text, rendered before the clock starts
+  };
+
+  using Trace = std::vector<Operation>;
+
+
+
+  Kind kindNamed( std::string_view name )
+  {
+    for( std::size_t i = 0; i < KIND_COUNT; ++i )   if( KIND_NAMES[i] == name )   return static_cast<Kind>( i );
+    throw std::invalid_argument( std::format( "unknown operation \"{}\"", name ) );
+  }
+
+
+
+  // Prepares an operation's merge list or load text from its grocery items
+  void prepare( Operation & operation )
+  {
+    if( operation.kind == Kind::MERGE )
+    {
+      for( auto const & groceryItem : operation.groceryItems )   operation.batch.insert( groceryItem, GroceryList::Position::BOTTOM );
+    }
+    else if( operation.kind == Kind::LOAD )
+    {
+      std::ostringstream stream;
+      for( auto const & groceryItem : operation.groceryItems )   stream << groceryItem << '\n';
+      operation.text = stream.str();
+    }
+  }
+
+
+
+  void writeTrace( std::ostream & stream, Trace const & trace )
+  {
+    for( auto const & operation : trace )
+    {
+      stream << KIND_NAMES[static_cast<std::size_t>( operation.kind )] << ' ' << operation.groceryItems.size();
+      for( auto const & groceryItem : operation.groceryItems )   stream << ' ' << groceryItem;
+      stream << '\n';
+    }
+  }
+
+
+
+  Trace readTrace( std::istream & stream )
+  {
+    Trace       trace;
+    std::string name;
+    std::size_t count = 0;
+    while( stream >> name >> count )
+    {
+      Operation operation;
+      operation.kind = kindNamed( name );
+      if( count == 0 || count > MAX_BATCH || ( count > 1 && operation.kind != Kind::MERGE && operation.kind != Kind::LOAD ) )
+      {
+        throw std::runtime_error( std::format( "trace operation {}:  {} can't carry {} grocery items", trace.size() + 1, name, count ) );
+      }
+
+      operation.groceryItems.resize( count );
+      for( auto & groceryItem : operation.groceryItems )
+      {
+        if( !( stream >> groceryItem ) )   throw std::runtime_error( std::format( "trace operation {}:  malformed grocery item", trace.size() + 1 ) );
+      }
+
+      prepare( operation );
+      trace.push_back( std::move( operation ) );
+    }
+
+    if( !stream.eof() )   throw std::runtime_error( std::format( "trace operation {}:  expected an operation name and count", trace.size() + 1 ) );
+    return trace;
+  }
+
+
+
+
+  /*******************************************************************************
+  **  Synthetic traffic
+  *******************************************************************************/
+  struct Options
+  {
+    unsigned                       threads     = std::max( std::thread::hardware_concurrency(), 1u );
+    std::size_t                    operations  = 100'000;                   // per thread
+    std::array<double, KIND_COUNT> mix         = { 40, 25, 20, 10, 5 };     // relative weights, in Kind order
+    std::size_t                    products    = 1'000;
+    std::size_t                    brands      = 50;
+    double                         productSkew = 1.0;
+    double                         brandSkew   = 1.0;
+    std::size_t                    listSize    = GroceryList::CAPACITY - MAX_BATCH;
+    std::size_t                    seed        = 1;
+    std::string                    tracePath;
+    std::string                    recordPath;
+  };
+
+
+
+  // Draws ranks 0, 1, 2, ... with probability proportional to 1 / (rank + 1)^skew
+  class Zipf
+  {
+    public:
+      Zipf( std::size_t count, double skew )
+      {
+        double total = 0.0;
+        _cumulative.reserve( count );
+        for( std::size_t rank = 1; rank <= count; ++rank )   _cumulative.push_back( total += 1.0 / std::pow( static_cast<double>( rank ), skew ) );
+      }
+
+      std::size_t operator()( std::mt19937_64 & engine ) const
+      {
+        auto target = std::uniform_real_distribution<double>( 0.0, _cumulative.back() )( engine );
+        auto rank   = static_cast<std::size_t>( std::upper_bound( _cumulative.begin(), _cumulative.end(), target ) - _cumulative.begin() );
+        return std::min( rank, _cumulative.size() - 1 );
+      }
+
+    private:
+      std::vector<double> _cumulative;                                      // running totals of the rank weights
+  };
+
+
+
+  class TrafficGenerator
+  {
+    public:
+      TrafficGenerator( Options const & options, std::size_t stream )
+        : _options( options ),
+          _engine ( options.seed * 0x9E37'79B9'7F4A'7C15ULL + stream ),     // a distinct, reproducible stream per thread
+          _product( options.products, options.productSkew ),
+          _brand  ( options.brands,   options.brandSkew   ),
+          _kind   ( options.mix.begin(), options.mix.end() )
+      {}
+
+      GroceryItem groceryItem()
+      {
+        // The UPC and price follow from the product and brand, so the same pair always makes the same grocery item
+        auto product = _product( _engine );
+        auto brand   = _brand  ( _engine );
+        return { std::format( "product {:05}", product ),
+                 std::format( "brand {:04}",   brand   ),
+                 std::format( "{:012}",        product * _options.brands + brand ),
+                 0.5 + static_cast<double>( ( product * 7 + brand ) % 2'000 ) / 100.0 };
+      }
+
+      Trace trace()
+      {
+        auto  batchLimit = std::min( MAX_BATCH, _options.listSize );
+        Trace trace( _options.operations );
+        for( auto & operation : trace )
+        {
+          operation.kind = static_cast<Kind>( _kind( _engine ) );
+
+          std::size_t count = 1;
+          if( operation.kind == Kind::MERGE || operation.kind == Kind::LOAD )   count = std::uniform_int_distribution<std::size_t>( 1, batchLimit )( _engine );
+          for( std::size_t i = 0; i < count; ++i )   operation.groceryItems.push_back( groceryItem() );
+
+          prepare( operation );
+        }
+        return trace;
+      }
+
+    private:
+      Options const &                         _options;
+      std::mt19937_64                         _engine;
+      Zipf                                    _product;
+      Zipf                                    _brand;
+      std::discrete_distribution<std::size_t> _kind;
+  };
+
+
+
+
+  /*******************************************************************************
+  **  Replay
+  *******************************************************************************/
+  using Clock     = std::chrono::steady_clock;
+  using Latencies = std::array<std::vector<std::int64_t>, KIND_COUNT>;      // nanoseconds, by Kind
+
+
+
+  struct ThreadResult
+  {
+    Latencies          latencies;
+    std::size_t        findHits = 0;
+    std::exception_ptr error;                                               // rethrown on the main thread once every thread has joined
+  };
+
+
+
+  // Drops grocery items from the bottom until needed more fit within listSize
+  void makeRoom( GroceryList & groceryList, std::size_t needed, std::size_t listSize )
+  {
+    while( groceryList.size() > 0 && groceryList.size() + needed > listSize )   groceryList.remove( groceryList.size() - 1 );
+  }
+
+
+
+  void replay( Trace const & trace, GroceryList & groceryList, std::size_t listSize, ThreadResult & result )
+  {
+    for( auto const & operation : trace )
+    {
+      auto & samples = result.latencies[static_cast<std::size_t>( operation.kind )];
+      auto   timed   = [&]( auto && body )
+      {
+        auto start = Clock::now();
+        body();
+        samples.push_back( std::chrono::duration_cast<std::chrono::nanoseconds>( Clock::now() - start ).count() );
+      };
+
+      auto const & groceryItem = operation.groceryItems.front();
+      switch( operation.kind )
+      {
+        case Kind::FIND:
+          timed( [&] { if( groceryList.find( groceryItem ) != groceryList.size() )   ++result.findHits; } );
+          break;
+
+        case Kind::INSERT:
+          makeRoom( groceryList, 1, listSize );
+          timed( [&] { groceryList.insert( groceryItem, GroceryList::Position::TOP ); } );
+          break;
+
+        case Kind::MOVE_TO_TOP:
+          timed( [&] { groceryList.moveToTop( groceryItem ); } );
+          break;
+
+        case Kind::MERGE:
+          makeRoom( groceryList, operation.groceryItems.size(), listSize );
+          timed( [&] { groceryList += operation.batch; } );
+          break;
+
+        case Kind::LOAD:
+        {
+          makeRoom( groceryList, operation.groceryItems.size(), listSize );
+          std::istringstream stream( operation.text );
+          timed( [&] { stream >> groceryList; } );
+          break;
+        }
+      }
+    }
+  }
+
+
+
+  // Nearest rank percentile of sorted samples, in microseconds
+  double percentile( std::vector<std::int64_t> const & sorted, double fraction )
+  {
+    if( sorted.empty() )   return 0.0;
+    auto rank = static_cast<std::size_t>( std::ceil( fraction * static_cast<double>( sorted.size() ) ) );
+    return static_cast<double>( sorted[std::clamp<std::size_t>( rank, 1, sorted.size() ) - 1] ) / 1'000.0;
+  }
+
+
+
+
+  /*******************************************************************************
+  **  Command line
+  *******************************************************************************/
+  Options parseOptions( int argc, char * argv[] )
+  {
+    Options options;
+    for( int i = 1; i < argc; ++i )
+    {
+      std::string_view argument = argv[i];
+      auto             equals   = argument.find( '=' );
+      if( !argument.starts_with( "--" ) || equals == std::string_view::npos )   throw std::invalid_argument( std::format( "expected --name=value, not \"{}\"", argument ) );
+
+      auto name  = argument.substr( 2, equals - 2 );
+      auto value = std::string( argument.substr( equals + 1 ) );
+
+      if     ( name == "threads"      )   options.threads     = static_cast<unsigned>( std::stoul( value ) );
+      else if( name == "operations"   )   options.operations  = std::stoull( value );
+      else if( name == "products"     )   options.products    = std::stoull( value );
+      else if( name == "brands"       )   options.brands      = std::stoull( value );
+      else if( name == "product-skew" )   options.productSkew = std::stod( value );
+      else if( name == "brand-skew"   )   options.brandSkew   = std::stod( value );
+      else if( name == "list-size"    )   options.listSize    = std::stoull( value );
+      else if( name == "seed"         )   options.seed        = std::stoull( value );
+      else if( name == "trace"        )   options.tracePath   = value;
+      else if( name == "record"       )   options.recordPath  = value;
+      else if( name == "mix"          )
+      {
+        // Kinds left out of the mix don't occur at all
+        options.mix = {};
+        std::istringstream entries( value );
+        for( std::string entry; std::getline( entries, entry, ',' ); )
+        {
+          auto colon = entry.find( ':' );
+          if( colon == std::string::npos )   throw std::invalid_argument( std::format( "expected kind:weight in --mix, not \"{}\"", entry ) );
+          options.mix[static_cast<std::size_t>( kindNamed( entry.substr( 0, colon ) ) )] = std::stod( entry.substr( colon + 1 ) );
+        }
+      }
+      else throw std::invalid_argument( std::format( "unknown option \"--{}\"", name ) );
+    }
+
+    auto totalWeight = 0.0;
+    for( auto weight : options.mix )
+    {
+      if( weight < 0.0 )   throw std::invalid_argument( "--mix weights can't be negative" );
+      totalWeight += weight;
+    }
+
+    if( options.threads == 0                                              )   throw std::invalid_argument( "--threads must be at least 1" );
+    if( options.products == 0 || options.brands == 0                      )   throw std::invalid_argument( "--products and --brands must be at least 1" );
+    if( options.listSize == 0 || options.listSize > GroceryList::CAPACITY )   throw std::invalid_argument( std::format( "--list-size must be between 1 and {}", GroceryList::CAPACITY ) );
+    if( totalWeight <= 0.0 && options.tracePath.empty()                   )   throw std::invalid_argument( "--mix needs at least one positive weight" );
+    return options;
+  }
+}    // unnamed, anonymous namespace
+
+
+
+
+int main( int argc, char * argv[] )
+{
+  try
+  {
+    auto options = parseOptions( argc, argv );
+
+
+    // Prepare every thread's trace and starting list before any clock starts
+    std::vector<Trace> traces;
+    if( !options.tracePath.empty() )
+    {
+      std::ifstream file( options.tracePath );
+      if( !file )   throw std::runtime_error( std::format( "unable to open trace \"{}\"", options.tracePath ) );
+      traces.push_back( readTrace( file ) );                                // shared by every thread
+    }
+    else
+    {
+      for( unsigned thread = 0; thread < options.threads; ++thread )   traces.push_back( TrafficGenerator( options, thread ).trace() );
+    }
+
+    if( !options.recordPath.empty() )
+    {
+      std::ofstream file( options.recordPath );
+      writeTrace( file, traces.front() );
+      if( !file )   throw std::runtime_error( std::format( "unable to write trace \"{}\"", options.recordPath ) );
+    }
+
+    std::vector<GroceryList> groceryLists( options.threads );
+    for( unsigned thread = 0; thread < options.threads; ++thread )
+    {
+      TrafficGenerator generator( options, options.threads + thread );
+      for( std::size_t attempts = 0; groceryLists[thread].size() < options.listSize && attempts < 100 * options.listSize; ++attempts )
+      {
+        groceryLists[thread].insert( generator.groceryItem(), GroceryList::Position::BOTTOM );
+      }
+    }
+
+
+    // Release every thread at once, and time the whole run from then until the last one finishes
+    std::vector<ThreadResult> results( options.threads );
+    std::latch                start( options.threads + 1 );
+    Clock::time_point         began;
+    {
+      std::vector<std::jthread> pool;
+      for( unsigned thread = 0; thread < options.threads; ++thread )
+      {
+        pool.emplace_back( [&, thread]
+        {
+          start.arrive_and_wait();
+          try
+          {
+            replay( traces[traces.size() == 1 ? 0 : thread], groceryLists[thread], options.listSize, results[thread] );
+          }
+          catch( ... )
+          {
+            results[thread].error = std::current_exception();
+          }
+        } );
+      }
+
+      start.arrive_and_wait();
+      began = Clock::now();
+    }                                                                       // jthreads join here
+    std::chrono::duration<double> elapsed = Clock::now() - began;
+
+    for( auto const & result : results )   if( result.error )   std::rethrow_exception( result.error );
+
+
+    // Report each kind's throughput and latency over every thread's samples
+    std::cout << std::format( "{} threads, {:.3f} s\n\n", options.threads, elapsed.count() );
+    std::cout << std::format( "{:<12}{:>12}{:>14}{:>12}{:>12}{:>12}\n", "operation", "count", "ops/sec", "p50 (us)", "p99 (us)", "p999 (us)" );
+
+    std::vector<std::int64_t> everything;
+    for( std::size_t kind = 0; kind < KIND_COUNT; ++kind )
+    {
+      std::vector<std::int64_t> samples;
+      for( auto const & result : results )   samples.insert( samples.end(), result.latencies[kind].begin(), result.latencies[kind].end() );
+      if( samples.empty() )   continue;
+
+      std::sort( samples.begin(), samples.end() );
+      std::cout << std::format( "{:<12}{:>12}{:>14.0f}{:>12.2f}{:>12.2f}{:>12.2f}\n",
+                                KIND_NAMES[kind], samples.size(), static_cast<double>( samples.size() ) / elapsed.count(),
+                                percentile( samples, 0.50 ), percentile( samples, 0.99 ), percentile( samples, 0.999 ) );
+      everything.insert( everything.end(), samples.begin(), samples.end() );
+    }
+
+    std::sort( everything.begin(), everything.end() );
+    std::cout << std::format( "{:<12}{:>12}{:>14.0f}{:>12.2f}{:>12.2f}{:>12.2f}\n",
+                              "all", everything.size(), static_cast<double>( everything.size() ) / elapsed.count(),
+                              percentile( everything, 0.50 ), percentile( everything, 0.99 ), percentile( everything, 0.999 ) );
+
+    // How often finds (and so moveToTops) land on a grocery item actually in the list says whether the mix is realistic
+    std::size_t finds    = 0;
+    std::size_t findHits = 0;
+    for( auto const & result : results ) { finds += result.latencies[static_cast<std::size_t>( Kind::FIND )].size();  findHits += result.findHits; }
+    if( finds > 0 )   std::cout << std::format( "\nfind hit rate {:.1f}%\n", 100.0 * static_cast<double>( findHits ) / static_cast<double>( finds ) );
+  }
+
+  catch( std::exception const & ex )
+  {
+    std::cerr << "Fatal Error:  " << ex.what() << '\n';
+    return 1;
+  }
+}
@@ -0,0 +1,85 @@
+// Prints where a grocery list's memory goes, container by container, for a list read from a file of grocery item text.
+//
+//    usage:  MemoryReport <file> [sampleSize]
+//
+// Build alongside the library's translation units, leaving out main.cpp, with the repository root on the include path.  With a
+// sample size the string figures are estimated from that many grocery items rather than measured exactly.
+#include <cstddef>                                                          // size_t
+#include <exception>                                                        // exception
+#include <format>                                                           // format()
+#include <fstream>                                                          // ifstream
+#include <iostream>                                                         // cout, cerr
+#include <limits>                                                           // numeric_limits
+#include <string>                                                           // stoull()
+#include <string_view>                                                      // string_view
+
+#include "GroceryList.hpp"
+
+
+
+
+namespace
+{
+  void printContainer( std::string_view name, GroceryList::ContainerUsage const & usage )
+  {
+    std::cout << std::format( "{:<8}{:>10}{:>12}{:>12}{:>12}{:>12}{:>12}{:>9.1f}%{:>12}{}\n",
+                              name, usage.elements, usage.inlineBytes, usage.unusedBytes, usage.nodeOverheadBytes,
+                              usage.stringHeapBytes, usage.stringPayloadBytes, usage.ssoHitRate() * 100.0, usage.totalBytes(),
+                              usage.estimated ? "  (estimated)" : "" );
+  }
+}
+
+
+
+
+int main( int argc, char * argv[] )
+{
+  try
+  {
+    if( argc < 2 || argc > 3 )
+    {
+      std::cerr << "usage:  " << argv[0] << " <file> [sampleSize]\n";
+      return 2;
+    }
+
+    std::ifstream file( argv[1] );
+    if( !file )
+    {
+      std::cerr << "unable to open \"" << argv[1] << "\"\n";
+      return 1;
+    }
+
+    auto sampleSize = argc == 3 ? static_cast<std::size_t>( std::stoull( argv[2] ) ) : std::numeric_limits<std::size_t>::max();
+
+    // A grocery list's capacity is limited, so report on what fits rather than nothing at all
+    GroceryList groceryList;
+    try
+    {
+      file >> groceryList;
+    }
+    catch( GroceryList::CapacityExceeded_Ex const & )
+    {
+      std::cerr << "note:  grocery list capacity reached, reporting on the first " << groceryList.size() << " grocery items\n";
+    }
+
+    auto usage = groceryList.memoryUsage( sampleSize );
+
+    std::cout << std::format( "{:<8}{:>10}{:>12}{:>12}{:>12}{:>12}{:>12}{:>10}{:>12}\n",
+                              "", "elements", "inline", "unused", "links", "heap", "payload", "SSO", "total" );
+    printContainer( "array",  usage.array  );
+    printContainer( "vector", usage.vector );
+    printContainer( "dll",    usage.dll    );
+    printContainer( "sll",    usage.sll    );
+    std::cout << '\n';
+    std::cout << std::format( "duplicate filter  {:>12} bytes\n", usage.duplicateFilterBytes );
+    std::cout << std::format( "indexes           {:>12} bytes (estimated)\n", usage.indexBytes );
+    std::cout << std::format( "GroceryList object{:>12} bytes (includes the array's inline and unused bytes)\n", sizeof( GroceryList ) );
+    std::cout << std::format( "total             {:>12} bytes\n", usage.totalBytes() + sizeof( GroceryList ) );
+  }
+
+  catch( std::exception const & ex )
+  {
+    std::cerr << "Fatal Error:  " << ex.what() << '\n';
+    return 1;
+  }
+}